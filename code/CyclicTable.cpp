@@ -0,0 +1,373 @@
+//*****************************************************************
+// CyclicTable.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "CyclicTable.h"
+#include "SchedulingAlgorithm.h"
+#include <algorithm>
+
+// Static member definitions
+const unsigned int CyclicTable::NO_ENTRY;
+
+// Nanoseconds per millisecond (periods are in milliseconds)
+static const uint64_t NS_PER_MS = 1000000ULL;
+
+/**
+ * Default constructor for an empty table.
+ */
+CyclicTable::CyclicTable()
+{
+	hyperperiod = 0;
+	current = 0;
+	currentRelease = 0;
+}
+
+/**
+ * Default, empty destructor.
+ */
+CyclicTable::~CyclicTable()
+{
+}
+
+/**
+ * Compile the table by simulating one hyperperiod of a scheduling
+ * algorithm over the task set.
+ *
+ * @param alg - the scheduling algorithm to compile
+ * @param taskSet - the collection of task compute/period pairs
+ * @param taskIDs - the (global) ID of each task
+ * @param cpus - the number of CPUs the tasks are globally scheduled on
+ * @param budget - the maximum size of the table in bytes
+ * @return true if the table was compiled, false if the hyperperiod or
+ *         the table exceeds the budget or the schedule does not repeat
+ */
+bool CyclicTable::compile(AlgorithmType alg, const vector<TaskData>& taskSet, const vector<unsigned int>& taskIDs,
+		unsigned int cpus, uint64_t budget)
+{
+	SchedulingAlgorithm* scheduler = SchedulingAlgorithm::create(alg);
+	TaskTable table;
+	vector<PriorityMove> moves;
+	vector<unsigned int> releases;
+	vector<unsigned int> running;
+	unsigned int idLimit = 0;
+	unsigned int now = 0;
+	unsigned int next;
+	unsigned int slot;
+	uint64_t time;
+	uint64_t end;
+	uint64_t step;
+	bool repeats = true;
+
+	entryAt.clear();
+	firstMove.clear();
+	entryMoves.clear();
+	initialOrder.clear();
+	current = 0;
+	currentRelease = 0;
+
+	// The time-indexed entry list alone must fit the budget
+	hyperperiod = hyperperiodOf(taskSet, min(budget / sizeof(unsigned int), (uint64_t)NO_ENTRY));
+	if (scheduler == NULL || hyperperiod == 0)
+	{
+		delete scheduler;
+		return false;
+	}
+
+	// Every task is released at time zero and its first deadline is one period later.
+	table.reset(taskSet.size());
+	for (unsigned int i = 0; i < taskSet.size(); i++)
+	{
+		table.add(taskIDs[i], taskSet[i].computeTime, taskSet[i].periodTime);
+		releases.push_back(taskSet[i].periodTime);
+		idLimit = max(idLimit, taskIDs[i] + 1);
+	}
+	scheduler->reserve(taskSet.size(), idLimit);
+	scheduler->resetOrder(table, moves);
+	initialOrder = scheduler->getOrder();
+	previous = initialOrder;
+	entryAt.assign(hyperperiod, NO_ENTRY);
+	firstMove.push_back(0);
+
+	// Simulate the hyperperiod one release instant at a time (mirrors Simulator::run()).
+	while (now < hyperperiod)
+	{
+		next = *min_element(releases.begin(), releases.end());
+
+		// Run the highest priority pending tasks (one per CPU) until the next instant
+		time = now * NS_PER_MS;
+		end = next * NS_PER_MS;
+		while (time < end)
+		{
+			const vector<unsigned int>& order = scheduler->getOrder();
+			running.clear();
+			for (unsigned int i = 0; i < order.size() && running.size() < cpus; i++)
+			{
+				slot = table.slotOf(order[i]);
+				if (table.getBacklog(slot) > 0)
+				{
+					running.push_back(slot);
+				}
+			}
+			if (running.empty())
+			{
+				break;
+			}
+
+			// Advance to the first completion (or the next instant)
+			step = end - time;
+			for (vector<unsigned int>::iterator itr = running.begin(); itr != running.end(); itr++)
+			{
+				step = min(step, (uint64_t)table.getRemainingTime(*itr));
+			}
+			for (vector<unsigned int>::iterator itr = running.begin(); itr != running.end(); itr++)
+			{
+				if (table.getRemainingTime(*itr) == step)
+				{
+					table.setCurrentComputeTime(*itr, 0);
+					table.setBacklog(*itr, table.getBacklog(*itr) - 1);
+				}
+				else
+				{
+					table.setCurrentComputeTime(*itr, table.getCurrentComputeTime(*itr) + step);
+				}
+			}
+			time += step;
+		}
+
+		// Expire every deadline at this instant, then re-rank each released task.
+		now = next;
+		for (slot = 0; slot < table.size(); slot++)
+		{
+			if (releases[slot] == now)
+			{
+				table.setDeadline(slot, table.getDeadline(slot) + table.getPeriodTime(slot));
+				table.setBacklog(slot, table.getBacklog(slot) + 1);
+				releases[slot] += table.getPeriodTime(slot);
+			}
+		}
+		for (slot = 0; slot < table.size(); slot++)
+		{
+			if ((now % table.getPeriodTime(slot)) == 0)
+			{
+				scheduler->taskChanged(table, table.getTaskID(slot), moves);
+			}
+		}
+
+		// Record the instant (the end of the hyperperiod is instant 0 of the next one)
+		addEntry(previous, scheduler->getOrder());
+		entryAt[now % hyperperiod] = getEntries() - 1;
+		previous = scheduler->getOrder();
+	}
+
+	// The table only repeats if the hyperperiod ends in the state it started in
+	for (slot = 0; slot < table.size(); slot++)
+	{
+		if (table.getBacklog(slot) != 1 || table.getCurrentComputeTime(slot) != 0)
+		{
+			repeats = false;
+		}
+	}
+	repeats = repeats && (previous == initialOrder);
+	delete scheduler;
+
+	if (!repeats || getSize() > budget)
+	{
+		entryAt.clear();
+		firstMove.clear();
+		entryMoves.clear();
+		return false;
+	}
+	current = entryAt[0];
+	return true;
+}
+
+/**
+ * Retrieve the hyperperiod of the task set, as computed by compile()
+ * (0 if it exceeds the budget).
+ *
+ * @return hyperperiod (ms)
+ */
+unsigned int CyclicTable::getHyperperiod() const
+{
+	return hyperperiod;
+}
+
+/**
+ * Retrieve the number of release instants in the table.
+ *
+ * @return number of table entries
+ */
+unsigned int CyclicTable::getEntries() const
+{
+	return firstMove.empty() ? 0 : (firstMove.size() - 1);
+}
+
+/**
+ * Retrieve the size of the compiled table.
+ *
+ * @return table size in bytes
+ */
+uint64_t CyclicTable::getSize() const
+{
+	return ((entryAt.size() + firstMove.size() + initialOrder.size()) * sizeof(unsigned int)) +
+			(entryMoves.size() * sizeof(PriorityMove));
+}
+
+/**
+ * Allocate every list up front (when the test starts), so that no
+ * later scheduling event allocates.
+ *
+ * @param numTasks - the number of tasks under control of the schedule test
+ * @param idLimit - one more than the largest task ID
+ */
+void CyclicTable::reserve(unsigned int numTasks, unsigned int idLimit)
+{
+	SchedulingPolicy<CyclicTable>::reserve(numTasks, idLimit);
+	replay.reserve(numTasks);
+}
+
+/**
+ * Build the priority list of the latest release instant (the latest
+ * release of any task in the task table) by replaying the table from
+ * the start of the hyperperiod.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param order - the list the task IDs are appended to in descending priority
+ */
+void CyclicTable::buildOrder(const TaskTable& table, vector<unsigned int>& order)
+{
+	unsigned int latest = 0;
+	unsigned int target;
+
+	for (unsigned int slot = 0; slot < table.size(); slot++)
+	{
+		latest = max(latest, releaseOf(table, slot));
+	}
+	target = entryAt[latest % hyperperiod];
+
+	// Replay every entry of the hyperperiod up to the target
+	replay = initialOrder;
+	for (current = entryAt[0]; current != target; )
+	{
+		current = (current + 1) % getEntries();
+		for (unsigned int m = firstMove[current]; m < firstMove[current + 1]; m++)
+		{
+			replay[entryMoves[m].rank] = entryMoves[m].taskID;
+		}
+	}
+	currentRelease = latest;
+
+	order.insert(order.end(), replay.begin(), replay.end());
+}
+
+/**
+ * Apply the moves of the release instant of a task's period event,
+ * unless another task's event at the same instant already did.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param id - the ID of the task whose period expired
+ * @param moves - filled with the new rank of every task that moved
+ */
+void CyclicTable::taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+{
+	unsigned int release = releaseOf(table, table.slotOf(id));
+
+	moves.clear();
+	if (release > currentRelease)
+	{
+		advance(release, moves);
+	}
+}
+
+/**
+ * Compute the hyperperiod of the task set.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @param limit - the largest hyperperiod of interest
+ * @return hyperperiod (ms), or 0 if it exceeds the limit
+ */
+uint64_t CyclicTable::hyperperiodOf(const vector<TaskData>& taskSet, uint64_t limit)
+{
+	uint64_t lcm = 1;
+	uint64_t a;
+	uint64_t b;
+	uint64_t r;
+
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		if ((*itr).periodTime <= 0)
+		{
+			return 0;
+		}
+
+		// lcm(lcm, period) = lcm / gcd(lcm, period) * period
+		a = lcm;
+		b = (*itr).periodTime;
+		while (b != 0)
+		{
+			r = a % b;
+			a = b;
+			b = r;
+		}
+		lcm = (lcm / a) * (*itr).periodTime;
+		if (lcm > limit)
+		{
+			return 0;
+		}
+	}
+	return lcm;
+}
+
+/**
+ * Append a table entry with the moves that turn one priority list
+ * into another.
+ *
+ * @param from - the priority list before the release instant
+ * @param to - the priority list after the release instant
+ */
+void CyclicTable::addEntry(const vector<unsigned int>& from, const vector<unsigned int>& to)
+{
+	PriorityMove move;
+
+	for (unsigned int i = 0; i < to.size(); i++)
+	{
+		if (from[i] != to[i])
+		{
+			move.taskID = to[i];
+			move.rank = i;
+			entryMoves.push_back(move);
+		}
+	}
+	firstMove.push_back(entryMoves.size());
+}
+
+/**
+ * Advance the current entry to the entry of a release instant,
+ * applying the moves of every entry on the way.
+ *
+ * @param release - the release instant (ms since the test started)
+ * @param moves - appended with every move applied
+ */
+void CyclicTable::advance(unsigned int release, vector<PriorityMove>& moves)
+{
+	unsigned int target = entryAt[release % hyperperiod];
+
+	// Normally the target is the next entry (one lookup and its moves)
+	while (current != target)
+	{
+		current = (current + 1) % getEntries();
+		for (unsigned int m = firstMove[current]; m < firstMove[current + 1]; m++)
+		{
+			placeTask(entryMoves[m].taskID, entryMoves[m].rank);
+			moves.push_back(entryMoves[m]);
+		}
+	}
+	currentRelease = release;
+}
@@ -0,0 +1,181 @@
+//*****************************************************************
+// CyclicTable.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef CYCLICTABLE_H_
+#define CYCLICTABLE_H_
+
+// Module includes
+#include "Project1.h"
+#include "SchedulingPolicy.h"
+
+/**
+ * This class is a scheduling policy that replays a cyclic-executive
+ * table instead of running an online algorithm. The table is compiled
+ * offline by simulating one hyperperiod (the LCM of the task periods) of
+ * the chosen algorithm: it holds the priority moves made at every release
+ * instant of the hyperperiod, indexed by the instant (in ms). A period
+ * event then looks up the instant it belongs to (from the task's deadline
+ * in the task table) and applies that instant's moves, so no algorithm
+ * runs during the test.
+ *
+ * A table is only compiled if it fits the given size budget and the
+ * simulated schedule repeats after one hyperperiod (the state at the end
+ * of the hyperperiod is the state at the start); otherwise the caller
+ * must fall back to online scheduling.
+ */
+class CyclicTable: public SchedulingPolicy<CyclicTable>
+{
+public:
+	/**
+	 * Default constructor for an empty table.
+	 */
+	CyclicTable();
+
+	/**
+	 * Default, empty destructor.
+	 */
+	~CyclicTable();
+
+	/**
+	 * Compile the table by simulating one hyperperiod of a scheduling
+	 * algorithm over the task set.
+	 *
+	 * @param alg - the scheduling algorithm to compile
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param taskIDs - the (global) ID of each task
+	 * @param cpus - the number of CPUs the tasks are globally scheduled on
+	 * @param budget - the maximum size of the table in bytes
+	 * @return true if the table was compiled, false if the hyperperiod or
+	 *         the table exceeds the budget or the schedule does not repeat
+	 */
+	bool compile(AlgorithmType alg, const vector<TaskData>& taskSet, const vector<unsigned int>& taskIDs,
+			unsigned int cpus, uint64_t budget);
+
+	/**
+	 * Retrieve the hyperperiod of the task set, as computed by compile()
+	 * (0 if it exceeds the budget).
+	 *
+	 * @return hyperperiod (ms)
+	 */
+	unsigned int getHyperperiod() const;
+
+	/**
+	 * Retrieve the number of release instants in the table.
+	 *
+	 * @return number of table entries
+	 */
+	unsigned int getEntries() const;
+
+	/**
+	 * Retrieve the size of the compiled table.
+	 *
+	 * @return table size in bytes
+	 */
+	uint64_t getSize() const;
+
+	/**
+	 * Allocate every list up front (when the test starts), so that no
+	 * later scheduling event allocates.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int numTasks, unsigned int idLimit);
+
+	/**
+	 * Build the priority list of the latest release instant (the latest
+	 * release of any task in the task table) by replaying the table from
+	 * the start of the hyperperiod.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param order - the list the task IDs are appended to in descending priority
+	 */
+	void buildOrder(const TaskTable& table, vector<unsigned int>& order);
+
+	/**
+	 * Apply the moves of the release instant of a task's period event,
+	 * unless another task's event at the same instant already did.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose period expired
+	 * @param moves - filled with the new rank of every task that moved
+	 */
+	void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves);
+
+private:
+	/**
+	 * Compute the hyperperiod of the task set.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param limit - the largest hyperperiod of interest
+	 * @return hyperperiod (ms), or 0 if it exceeds the limit
+	 */
+	static uint64_t hyperperiodOf(const vector<TaskData>& taskSet, uint64_t limit);
+
+	/**
+	 * Append a table entry with the moves that turn one priority list
+	 * into another.
+	 *
+	 * @param from - the priority list before the release instant
+	 * @param to - the priority list after the release instant
+	 */
+	void addEntry(const vector<unsigned int>& from, const vector<unsigned int>& to);
+
+	/**
+	 * Retrieve the (absolute) instant of a task's latest release.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param slot - the task's slot
+	 * @return release instant (ms since the test started)
+	 */
+	inline unsigned int releaseOf(const TaskTable& table, unsigned int slot) const
+	{
+		return table.getDeadline(slot) - table.getPeriodTime(slot);
+	}
+
+	/**
+	 * Advance the current entry to the entry of a release instant,
+	 * applying the moves of every entry on the way.
+	 *
+	 * @param release - the release instant (ms since the test started)
+	 * @param moves - appended with every move applied
+	 */
+	void advance(unsigned int release, vector<PriorityMove>& moves);
+
+	// Hyperperiod of the task set (ms)
+	unsigned int hyperperiod;
+
+	// The entry of every release instant of the hyperperiod (indexed by ms,
+	// NO_ENTRY between instants)
+	vector<unsigned int> entryAt;
+
+	// The moves of each entry in time order (entry e owns moves firstMove[e]
+	// to firstMove[e + 1] - 1); the last entry is the instant that ends one
+	// hyperperiod and starts the next, so entry 0 follows it
+	vector<unsigned int> firstMove;
+	vector<PriorityMove> entryMoves;
+
+	// The priority list at the start of each hyperperiod
+	vector<unsigned int> initialOrder;
+
+	// The entry most recently applied and its release instant (ms since
+	// the test started)
+	unsigned int current;
+	unsigned int currentRelease;
+
+	// Scratch lists used to compile and replay the table
+	vector<unsigned int> replay;
+	vector<unsigned int> previous;
+
+	// Entry value for "no release instant"
+	static const unsigned int NO_ENTRY = 0xFFFFFFFF;
+};
+
+#endif /* CYCLICTABLE_H_ */
@@ -25,52 +25,72 @@ EDFAlgorithm::~EDFAlgorithm()
 {
 }
 
+/**
+ * Allocate every list up front (when the test starts), so that no
+ * later scheduling event allocates.
+ *
+ * @param numTasks - the number of tasks under control of the schedule test
+ * @param idLimit - one more than the largest task ID
+ */
+void EDFAlgorithm::reserve(unsigned int numTasks, unsigned int idLimit)
+{
+	SchedulingPolicy<EDFAlgorithm>::reserve(numTasks, idLimit);
+	readyQueue.reserve(numTasks, idLimit);
+}
+
 /**
  * Apply the EDF algorithm to build a list of task priorities
  * that is then used to reschedule tasks during the schedule test.
  *
- * @param tasks - list of tasks under control of the schedule test
- * @return descending priority list of tasks used for scheduling.
+ * @param table - the tasks under control of the schedule test
+ * @param order - the list the task IDs are appended to in descending priority
  */
-vector<unsigned int> EDFAlgorithm::scheduleTasks(vector<Task*> tasks)
+void EDFAlgorithm::buildOrder(const TaskTable& table, vector<unsigned int>& order)
 {
-	vector<Task*> sorted;
-	vector<unsigned int> priorities;
+	unsigned int id;
+	uint64_t key;
 
-	// Sort the tasks based on their upcoming deadlines
-	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	// Update the key of every task whose deadline moved since the last event.
+	// Deadlines are updated with each periodic event, so we don't have to do any
+	// math to figure out which period we are in for each task.
+	for (unsigned int slot = 0; slot < table.size(); slot++)
 	{
-		if (priorities.empty())
+		id = table.getTaskID(slot);
+		key = table.getDeadline(slot);
+		if (!readyQueue.contains(id))
 		{
-			// Insert something to start
-			sorted.push_back(*itr);
+			readyQueue.push(id, key);
 		}
-		else
+		else if (readyQueue.key(id) != key)
 		{
-			bool inserted = false;
-			for (vector<Task*>::iterator pitr = sorted.begin(); pitr != sorted.end(); pitr++)
-			{
-				// Deadlines are updated with each periodic event, so we don't have to do any
-				// math to figure out which period we are in for each task.
-				if ((*itr)->getDeadline() <= (*pitr)->getDeadline())
-				{
-					sorted.insert(pitr, *pitr);
-					inserted = true;
-					break;
-				}
-			}
-			if (!inserted)
-			{
-				sorted.push_back(*itr);
-			}
+			readyQueue.update(id, key);
 		}
 	}
 
-	// Populate the priorities vector based on the now sorted list
-	for (vector<Task*>::iterator itr = sorted.begin(); itr != sorted.end(); itr++)
+	// Populate the priority list in ascending key order
+	order.reserve(order.size() + table.size());
+	readyQueue.topK(table.size(), order);
+}
+
+/**
+ * Re-key a single task after its deadline moved and binary search
+ * its new rank in the current priority list, so only the tasks it
+ * passes over change rank.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param id - the ID of the task whose deadline changed
+ * @param moves - filled with the new rank of every task that moved
+ */
+void EDFAlgorithm::taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+{
+	// Fall back to a full rebuild if the order was never initialized.
+	if (!readyQueue.contains(id) || getOrder().empty())
 	{
-		priorities.push_back((*itr)->taskID());
+		SchedulingPolicy<EDFAlgorithm>::taskChanged(table, id, moves);
+		return;
 	}
 
-	return priorities;
+	moves.clear();
+	readyQueue.update(id, table.getDeadline(table.slotOf(id)));
+	rerankTask(id, readyQueue, moves);
 }
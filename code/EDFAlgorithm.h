@@ -12,13 +12,14 @@
 #define EDFALGORITHM_H_
 
 // Module Includes
-#include "SchedulingAlgorithm.h"
+#include "SchedulingPolicy.h"
+#include "TaskHeap.h"
 
 /**
  * This class is responsible for encapsulating the
  * Earliest Deadline First (EDF) algorithm for scheduling.
  */
-class EDFAlgorithm: public SchedulingAlgorithm
+class EDFAlgorithm: public SchedulingPolicy<EDFAlgorithm>
 {
 public:
 	/**
@@ -29,16 +30,40 @@ public:
 	/**
 	 * Default, empty destructor.
 	 */
-	virtual ~EDFAlgorithm();
+	~EDFAlgorithm();
+
+	/**
+	 * Allocate every list up front (when the test starts), so that no
+	 * later scheduling event allocates.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int numTasks, unsigned int idLimit);
 
 	/**
 	 * Apply the EDF algorithm to build a list of task priorities
 	 * that is then used to reschedule tasks during the schedule test.
 	 *
-	 * @param tasks - list of tasks under control of the schedule test
-	 * @return descending priority list of tasks used for scheduling.
+	 * @param table - the tasks under control of the schedule test
+	 * @param order - the list the task IDs are appended to in descending priority
 	 */
-	vector<unsigned int> scheduleTasks(vector<Task*> tasks);
+	void buildOrder(const TaskTable& table, vector<unsigned int>& order);
+
+	/**
+	 * Re-key a single task after its deadline moved and binary search
+	 * its new rank in the current priority list, so only the tasks it
+	 * passes over change rank.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose deadline changed
+	 * @param moves - filled with the new rank of every task that moved
+	 */
+	void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves);
+
+private:
+	// Persistent ready queue keyed by each task's absolute deadline
+	TaskHeap readyQueue;
 };
 
 #endif /* EDFALGORITHM_H_ */
@@ -0,0 +1,116 @@
+//*****************************************************************
+// JobLog.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "JobLog.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Default constructor for an empty log.
+ */
+JobLog::JobLog()
+{
+	reset(0, 0);
+}
+
+/**
+ * Default destructor (no tear-down required).
+ */
+JobLog::~JobLog()
+{
+}
+
+/**
+ * Discard every job and allocate the storage of a test.
+ *
+ * @param capacity - the largest number of jobs recorded (later jobs are dropped)
+ * @param period - the task's period in (fractional) clock cycles
+ */
+void JobLog::reset(unsigned int capacity, double period)
+{
+	JobRecord empty = { 0, 0, 0 };
+
+	jobs.assign(capacity, empty);
+	released = 0;
+	finished = 0;
+	testStart = 0;
+	this->period = period;
+}
+
+/**
+ * Start the test: the first job is released.
+ *
+ * @param cycles - the time the test started
+ */
+void JobLog::start(uint64_t cycles)
+{
+	testStart = cycles;
+	release(cycles);
+}
+
+/**
+ * Format the number of jobs released and finished, and the minimum,
+ * p50, p99 and maximum response time and release jitter (in
+ * microseconds, over the finished jobs) as a comma-separated log line.
+ *
+ * @param buffer - the destination buffer
+ * @param size - the size of the destination buffer
+ * @param label - the first field of the line
+ * @param cps - the clock rate of the recorded times
+ */
+void JobLog::format(char* buffer, size_t size, const char* label, uint64_t cps) const
+{
+	double usPerCycle = 1000000.0 / (double)cps;
+	unsigned int recorded = min((unsigned int)jobs.size(), (unsigned int)finished);
+	vector<double> responseTimes;
+	vector<double> jitters;
+	double nominal;
+
+	// Measure every finished job against its nominal release
+	responseTimes.reserve(recorded);
+	jitters.reserve(recorded);
+	for (unsigned int k = 0; k < recorded; k++)
+	{
+		nominal = (double)testStart + (k * period);
+		responseTimes.push_back(((double)jobs[k].finish - nominal) * usPerCycle);
+		jitters.push_back(((double)jobs[k].release - nominal) * usPerCycle);
+	}
+
+	if (recorded == 0)
+	{
+		snprintf(buffer, size, "%s,%u,%u,0,0,0,0,0,0,0,0", label, released, finished);
+		return;
+	}
+	sort(responseTimes.begin(), responseTimes.end());
+	sort(jitters.begin(), jitters.end());
+	snprintf(buffer, size, "%s,%u,%u,%f,%f,%f,%f,%f,%f,%f,%f", label, released, finished,
+			responseTimes.front(), percentileOf(responseTimes, 50.0), percentileOf(responseTimes, 99.0),
+			responseTimes.back(), jitters.front(), percentileOf(jitters, 50.0), percentileOf(jitters, 99.0),
+			jitters.back());
+}
+
+/**
+ * Retrieve a percentile (nearest rank) of sorted values.
+ *
+ * @param values - the values in ascending order (not empty)
+ * @param percentile - the percentile (0 to 100)
+ * @return the value
+ */
+double JobLog::percentileOf(const vector<double>& values, double percentile)
+{
+	unsigned int rank = (unsigned int)ceil((percentile / 100.0) * values.size());
+
+	if (rank == 0)
+	{
+		rank = 1;
+	}
+	return values[min(rank, (unsigned int)values.size()) - 1];
+}
@@ -0,0 +1,146 @@
+//*****************************************************************
+// JobLog.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef JOBLOG_H_
+#define JOBLOG_H_
+
+// Module includes
+#include "Project1.h"
+
+// Timestamps of one job (in clock cycles, 0 until the event happened)
+typedef struct
+{
+	uint64_t release;
+	uint64_t start;
+	uint64_t finish;
+} JobRecord;
+
+/**
+ * This class records the release, start and finish time of every job of
+ * a task in storage that is allocated before the test starts, and then
+ * summarizes them as the distributions of the task's response times and
+ * release jitter.
+ *
+ * Job k is nominally released k periods after the test starts; its release
+ * jitter is the delay of the period event that released it (its actual
+ * release) after its nominal release. Its response time runs from its
+ * nominal release to its finish, so it includes the release jitter (as a
+ * deadline does) and the largest response time is the observed worst-case
+ * response time (WCRT), directly comparable with the analytical WCRT of
+ * response-time analysis (see Schedulability).
+ *
+ * Jobs finish in release order, so the job that runs is always the oldest
+ * unfinished one. Releases are recorded by the period event and starts and
+ * finishes by the task thread (or, in virtual time, by the simulator).
+ */
+class JobLog
+{
+public:
+	/**
+	 * Default constructor for an empty log.
+	 */
+	JobLog();
+
+	/**
+	 * Default destructor (no tear-down required).
+	 */
+	~JobLog();
+
+	/**
+	 * Discard every job and allocate the storage of a test.
+	 *
+	 * @param capacity - the largest number of jobs recorded (later jobs are dropped)
+	 * @param period - the task's period in (fractional) clock cycles
+	 */
+	void reset(unsigned int capacity, double period);
+
+	/**
+	 * Start the test: the first job is released.
+	 *
+	 * @param cycles - the time the test started
+	 */
+	void start(uint64_t cycles);
+
+	/**
+	 * Record the release of the next job.
+	 *
+	 * @param cycles - the time the job was released
+	 */
+	inline void release(uint64_t cycles)
+	{
+		if (released < jobs.size())
+		{
+			jobs[released].release = cycles;
+		}
+		released++;
+	}
+
+	/**
+	 * Record that the oldest unfinished job runs (only its first run counts).
+	 *
+	 * @param cycles - the time the job ran
+	 */
+	inline void run(uint64_t cycles)
+	{
+		if (finished < released && finished < jobs.size() && jobs[finished].start == 0)
+		{
+			jobs[finished].start = cycles;
+		}
+	}
+
+	/**
+	 * Record that the oldest unfinished job finished.
+	 *
+	 * @param cycles - the time the job finished
+	 */
+	inline void finish(uint64_t cycles)
+	{
+		if (finished < jobs.size())
+		{
+			jobs[finished].finish = cycles;
+		}
+		finished++;
+	}
+
+	/**
+	 * Format the number of jobs released and finished, and the minimum,
+	 * p50, p99 and maximum response time and release jitter (in
+	 * microseconds, over the finished jobs) as a comma-separated log line.
+	 *
+	 * @param buffer - the destination buffer
+	 * @param size - the size of the destination buffer
+	 * @param label - the first field of the line
+	 * @param cps - the clock rate of the recorded times
+	 */
+	void format(char* buffer, size_t size, const char* label, uint64_t cps) const;
+
+private:
+	/**
+	 * Retrieve a percentile (nearest rank) of sorted values.
+	 *
+	 * @param values - the values in ascending order (not empty)
+	 * @param percentile - the percentile (0 to 100)
+	 * @return the value
+	 */
+	static double percentileOf(const vector<double>& values, double percentile);
+
+	// The recorded jobs (sized when the test starts)
+	vector<JobRecord> jobs;
+
+	// Number of jobs released and finished so far
+	volatile unsigned int released;
+	unsigned int finished;
+
+	// The time the test started and the task's period (clock cycles)
+	uint64_t testStart;
+	double period;
+};
+
+#endif /* JOBLOG_H_ */
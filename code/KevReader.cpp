@@ -0,0 +1,269 @@
+//*****************************************************************
+// KevReader.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "KevReader.h"
+#include <cctype>
+#include <cstring>
+
+// Private constants
+#define HEADER_BEGIN "TRACE_HEADER_BEGIN::"
+#define HEADER_END   "TRACE_HEADER_END::"
+#define KEY_PREFIX   "TRACE_"
+
+/**
+ * Determine whether a header key ("TRACE_XXX::") starts at a position.
+ *
+ * @param text - the header text
+ * @param pos - the position to check
+ * @return the length of the key without the "::" separator, or 0
+ */
+static size_t keyLength(const string& text, size_t pos)
+{
+	size_t end = pos;
+
+	if (text.compare(pos, strlen(KEY_PREFIX), KEY_PREFIX) != 0)
+	{
+		return 0;
+	}
+	while (end < text.size() && (isupper(text[end]) || isdigit(text[end]) || text[end] == '_'))
+	{
+		end++;
+	}
+	if (text.compare(end, 2, "::") != 0)
+	{
+		return 0;
+	}
+	return end - pos;
+}
+
+/**
+ * Default constructor for a reader with no open file.
+ */
+KevReader::KevReader()
+{
+	file = NULL;
+	cps = 0;
+	buffer = new unsigned char[BUFFER_EVENTS * EVENT_SIZE];
+	bufferCount = 0;
+	bufferIndex = 0;
+	timeHigh = 0;
+	lastLow = 0;
+	eventCount = 0;
+}
+
+/**
+ * Default destructor that closes the open file (if any).
+ */
+KevReader::~KevReader()
+{
+	close();
+	delete[] buffer;
+}
+
+/**
+ * Open a trace file, parse its header and skip the system page.
+ *
+ * @param path - the file to open
+ * @return true on success, false if the file is missing or malformed
+ */
+bool KevReader::open(const char* path)
+{
+	long syspageLength;
+
+	close();
+
+	file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		return false;
+	}
+	if (!parseHeader())
+	{
+		close();
+		return false;
+	}
+
+	// Skip the system page that follows the header
+	syspageLength = atol(getHeader("TRACE_SYSPAGE_LEN").c_str());
+	if (syspageLength > 0 && fseek(file, syspageLength, SEEK_CUR) != 0)
+	{
+		close();
+		return false;
+	}
+
+	cps = strtoull(getHeader("TRACE_CYCLES_PER_SEC").c_str(), NULL, 10);
+	return true;
+}
+
+/**
+ * Close the open file (if any).
+ */
+void KevReader::close()
+{
+	if (file != NULL)
+	{
+		fclose(file);
+	}
+	file = NULL;
+	header.clear();
+	cps = 0;
+	bufferCount = 0;
+	bufferIndex = 0;
+	timeHigh = 0;
+	lastLow = 0;
+	eventCount = 0;
+}
+
+/**
+ * Decode the next event.
+ *
+ * @param event - the event to fill
+ * @return true if an event was read, false at the end of the trace
+ */
+bool KevReader::next(KevEvent& event)
+{
+	const unsigned char* raw;
+	uint32_t words[4];
+
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	// Refill the read buffer (a trailing partial event is ignored)
+	if (bufferIndex >= bufferCount)
+	{
+		bufferCount = fread(buffer, EVENT_SIZE, BUFFER_EVENTS, file);
+		bufferIndex = 0;
+		if (bufferCount == 0)
+		{
+			return false;
+		}
+	}
+
+	// Decode the little-endian words
+	raw = buffer + (bufferIndex++ * EVENT_SIZE);
+	for (int i = 0; i < 4; i++)
+	{
+		words[i] = (uint32_t)raw[i * 4] | ((uint32_t)raw[(i * 4) + 1] << 8) |
+				((uint32_t)raw[(i * 4) + 2] << 16) | ((uint32_t)raw[(i * 4) + 3] << 24);
+	}
+	event.structure = (words[0] >> 30) & 0x3;
+	event.cpu = (words[0] >> 24) & 0x3F;
+	event.eventClass = (words[0] >> 10) & 0x1F;
+	event.event = words[0] & 0x3FF;
+	event.data[0] = words[2];
+	event.data[1] = words[3];
+
+	// Rebuild the full timestamp: time events carry the high word, and
+	// a large backwards step of the low word is a wrap
+	if (event.structure == KEV_STRUCT_SIMPLE && event.eventClass == KEV_CLASS_CONTROL &&
+			event.event == KEV_CONTROL_TIME)
+	{
+		timeHigh = event.data[0];
+	}
+	else if (words[1] < lastLow && (lastLow - words[1]) > 0x80000000U)
+	{
+		timeHigh++;
+	}
+	lastLow = words[1];
+	event.timestamp = (timeHigh << 32) | words[1];
+
+	eventCount++;
+	return true;
+}
+
+/**
+ * Retrieve a header value.
+ *
+ * @param key - the header key (e.g. "TRACE_CPU_NUM")
+ * @return the value, or an empty string if the key is not present
+ */
+string KevReader::getHeader(const string& key) const
+{
+	map<string, string>::const_iterator itr = header.find(key);
+	return (itr == header.end()) ? string() : itr->second;
+}
+
+/**
+ * Retrieve the cycle counter rate from the header.
+ *
+ * @return cycles per second
+ */
+uint64_t KevReader::getCyclesPerSec() const
+{
+	return cps;
+}
+
+/**
+ * Retrieve the number of events decoded so far.
+ *
+ * @return number of events
+ */
+uint64_t KevReader::getEventCount() const
+{
+	return eventCount;
+}
+
+/**
+ * Read and parse the text header.
+ *
+ * @return true on success, false if the header is malformed
+ */
+bool KevReader::parseHeader()
+{
+	string text;
+	size_t pos;
+	size_t length;
+	size_t valueStart;
+	size_t valueEnd;
+	int c;
+
+	// Read up to (and including) the end marker
+	while (text.size() < MAX_HEADER_SIZE && (c = fgetc(file)) != EOF)
+	{
+		text.push_back((char)c);
+		if (c == ':' && text.size() >= strlen(HEADER_END) &&
+				text.compare(text.size() - strlen(HEADER_END), strlen(HEADER_END), HEADER_END) == 0)
+		{
+			break;
+		}
+	}
+	if (text.compare(0, strlen(HEADER_BEGIN), HEADER_BEGIN) != 0 ||
+			text.size() < strlen(HEADER_END) ||
+			text.compare(text.size() - strlen(HEADER_END), strlen(HEADER_END), HEADER_END) != 0)
+	{
+		return false;
+	}
+
+	// Split the KEY::value pairs; a value runs until the next key
+	pos = 0;
+	while (pos < text.size() && (length = keyLength(text, pos)) > 0)
+	{
+		valueStart = pos + length + 2;
+		valueEnd = valueStart;
+		while (valueEnd < text.size() && keyLength(text, valueEnd) == 0)
+		{
+			valueEnd++;
+		}
+
+		// Trim the trailing newline some values carry
+		length = valueEnd;
+		while (length > valueStart && isspace(text[length - 1]))
+		{
+			length--;
+		}
+		header[text.substr(pos, keyLength(text, pos))] = text.substr(valueStart, length - valueStart);
+		pos = valueEnd;
+	}
+
+	return true;
+}
@@ -0,0 +1,166 @@
+//*****************************************************************
+// KevReader.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef KEVREADER_H_
+#define KEVREADER_H_
+
+// Module includes
+#include "Project1.h"
+
+/*
+ * QNX kernel trace (.kev) layout, as written by tracelogger:
+ *
+ *   "TRACE_HEADER_BEGIN::" followed by KEY::value pairs (no separators)
+ *   "TRACE_HEADER_END::"
+ *   TRACE_SYSPAGE_LEN bytes of system page
+ *   16-byte events: header, low 32 bits of the cycle counter, data[2]
+ *
+ * The event header packs the structure (bits 30-31: simple or combine
+ * begin/continue/end), the CPU (bits 24-29), the class (bits 10-14) and
+ * the event code (bits 0-9). The upper 32 bits of the cycle counter only
+ * appear in control/time events, so the reader tracks them and also
+ * corrects for wraps of the low word in between.
+ */
+
+// Event structure
+#define KEV_STRUCT_SIMPLE     (0)
+#define KEV_STRUCT_COMB_BEGIN (1)
+#define KEV_STRUCT_COMB_CONT  (2)
+#define KEV_STRUCT_COMB_END   (3)
+
+// Event classes
+#define KEV_CLASS_CONTROL (1)
+#define KEV_CLASS_THREAD  (4) // process and thread events
+#define KEV_CLASS_USER    (6)
+
+// Control events (data = {high word, low word} and {sequence, events})
+#define KEV_CONTROL_TIME   (1)
+#define KEV_CONTROL_BUFFER (2)
+
+// Thread events (data = {pid, tid}); the event code is the new thread state
+#define KEV_THREAD_DEAD    (0)
+#define KEV_THREAD_RUNNING (1)
+#define KEV_THREAD_READY   (2)
+#define KEV_THREAD_CREATE  (24)
+#define KEV_THREAD_DESTROY (25)
+
+// Combined process/thread name events (not decoded)
+#define KEV_PROCESS_NAME   (0xC0)
+#define KEV_THREAD_NAME    (0x140)
+
+// A single decoded trace event
+typedef struct
+{
+	uint64_t timestamp;      // full (wrap-corrected) cycle counter value
+	unsigned int structure;  // KEV_STRUCT_*
+	unsigned int cpu;        // the CPU that logged the event
+	unsigned int eventClass; // KEV_CLASS_*
+	unsigned int event;      // class-specific event code
+	uint32_t data[2];        // event payload (user events: {event, data})
+} KevEvent;
+
+/**
+ * This class is a streaming reader for QNX kernel trace files. It parses
+ * the text header up front and then decodes events on demand from a
+ * fixed-size read buffer, so arbitrarily large traces are processed in
+ * constant memory.
+ */
+class KevReader
+{
+public:
+	/**
+	 * Default constructor for a reader with no open file.
+	 */
+	KevReader();
+
+	/**
+	 * Default destructor that closes the open file (if any).
+	 */
+	virtual ~KevReader();
+
+	/**
+	 * Open a trace file, parse its header and skip the system page.
+	 *
+	 * @param path - the file to open
+	 * @return true on success, false if the file is missing or malformed
+	 */
+	bool open(const char* path);
+
+	/**
+	 * Close the open file (if any).
+	 */
+	void close();
+
+	/**
+	 * Decode the next event.
+	 *
+	 * @param event - the event to fill
+	 * @return true if an event was read, false at the end of the trace
+	 */
+	bool next(KevEvent& event);
+
+	/**
+	 * Retrieve a header value.
+	 *
+	 * @param key - the header key (e.g. "TRACE_CPU_NUM")
+	 * @return the value, or an empty string if the key is not present
+	 */
+	string getHeader(const string& key) const;
+
+	/**
+	 * Retrieve the cycle counter rate from the header.
+	 *
+	 * @return cycles per second
+	 */
+	uint64_t getCyclesPerSec() const;
+
+	/**
+	 * Retrieve the number of events decoded so far.
+	 *
+	 * @return number of events
+	 */
+	uint64_t getEventCount() const;
+
+private:
+	// The open trace file
+	FILE* file;
+
+	// Parsed header
+	map<string, string> header;
+	uint64_t cps;
+
+	// Read buffer
+	unsigned char* buffer;
+	size_t bufferCount;
+	size_t bufferIndex;
+
+	// Timestamp reconstruction state
+	uint64_t timeHigh;
+	uint32_t lastLow;
+
+	// Number of events decoded
+	uint64_t eventCount;
+
+	// Size of an encoded event and of the read buffer (in events)
+	static const unsigned int EVENT_SIZE = 16;
+	static const unsigned int BUFFER_EVENTS = 1024;
+
+	// Upper bound on the text header size
+	static const unsigned int MAX_HEADER_SIZE = 65536;
+
+	/**
+	 * Read and parse the text header.
+	 *
+	 * @return true on success, false if the header is malformed
+	 */
+	bool parseHeader();
+};
+
+#endif /* KEVREADER_H_ */
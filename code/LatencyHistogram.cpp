@@ -0,0 +1,155 @@
+//*****************************************************************
+// LatencyHistogram.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "LatencyHistogram.h"
+#include <cstring>
+
+/**
+ * Default constructor for an empty histogram.
+ */
+LatencyHistogram::LatencyHistogram()
+{
+	reset();
+}
+
+/**
+ * Default destructor (no tear-down required).
+ */
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+/**
+ * Discard every recorded value.
+ */
+void LatencyHistogram::reset()
+{
+	memset(counts, 0, sizeof(counts));
+	maxValue = 0;
+}
+
+/**
+ * Add every value recorded by another histogram to this one.
+ *
+ * @param other - the histogram to merge
+ */
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+	for (unsigned int i = 0; i < BUCKETS; i++)
+	{
+		counts[i] += other.counts[i];
+	}
+	if (other.maxValue > maxValue)
+	{
+		maxValue = other.maxValue;
+	}
+}
+
+/**
+ * Retrieve the number of recorded values.
+ *
+ * @return number of values
+ */
+uint64_t LatencyHistogram::count() const
+{
+	uint64_t total = 0;
+
+	for (unsigned int i = 0; i < BUCKETS; i++)
+	{
+		total += counts[i];
+	}
+	return total;
+}
+
+/**
+ * Retrieve the value at a percentile (the upper bound of the bucket
+ * that holds it, capped at the maximum).
+ *
+ * @param percentile - the percentile (0 to 100)
+ * @return the value in clock cycles (0 if the histogram is empty)
+ */
+uint64_t LatencyHistogram::percentile(double percentile) const
+{
+	uint64_t total = count();
+	uint64_t target;
+	uint64_t seen = 0;
+
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	// The rank of the value at the percentile (at least the first value)
+	target = (uint64_t)((percentile / 100.0) * total + 0.5);
+	if (target == 0)
+	{
+		target = 1;
+	}
+
+	for (unsigned int i = 0; i < BUCKETS; i++)
+	{
+		seen += counts[i];
+		if (seen >= target)
+		{
+			return (upperBound(i) < maxValue) ? upperBound(i) : maxValue;
+		}
+	}
+	return maxValue;
+}
+
+/**
+ * Retrieve the largest recorded value.
+ *
+ * @return the maximum in clock cycles
+ */
+uint64_t LatencyHistogram::max() const
+{
+	return maxValue;
+}
+
+/**
+ * Format the count, p50, p99, p99.9 and maximum (in microseconds)
+ * as a comma-separated log line.
+ *
+ * @param buffer - the destination buffer
+ * @param size - the size of the destination buffer
+ * @param label - the first field of the line
+ * @param cps - the clock rate of the recorded values
+ */
+void LatencyHistogram::format(char* buffer, size_t size, const char* label, uint64_t cps) const
+{
+	double usPerCycle = 1000000.0 / (double)cps;
+
+	snprintf(buffer, size, "%s,%llu,%f,%f,%f,%f", label, (unsigned long long)count(),
+			percentile(50.0) * usPerCycle, percentile(99.0) * usPerCycle,
+			percentile(99.9) * usPerCycle, maxValue * usPerCycle);
+}
+
+/**
+ * Retrieve the largest value that maps to a bucket.
+ *
+ * @param bucket - the bucket index
+ * @return the bucket's upper bound
+ */
+uint64_t LatencyHistogram::upperBound(unsigned int bucket)
+{
+	unsigned int shift;
+	uint64_t sub;
+
+	if (bucket < SUB_BUCKETS)
+	{
+		return bucket;
+	}
+
+	shift = ((bucket - SUB_BUCKETS) / HALF_BUCKETS) + 1;
+	sub = ((bucket - SUB_BUCKETS) % HALF_BUCKETS) + HALF_BUCKETS;
+	return ((sub + 1) << shift) - 1;
+}
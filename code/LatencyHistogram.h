@@ -0,0 +1,137 @@
+//*****************************************************************
+// LatencyHistogram.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef LATENCYHISTOGRAM_H_
+#define LATENCYHISTOGRAM_H_
+
+// Module includes
+#include "Project1.h"
+
+/**
+ * This class is a fixed-memory, log-bucketed (HDR-style) histogram of
+ * latencies measured in clock cycles. Values below SUB_BUCKETS are counted
+ * exactly; above that every power of two is split into SUB_BUCKETS / 2
+ * linear buckets, so any recorded value is reported to within about 1.5%
+ * over the full 64-bit range. Recording is a bit scan and an increment.
+ */
+class LatencyHistogram
+{
+public:
+	/**
+	 * Default constructor for an empty histogram.
+	 */
+	LatencyHistogram();
+
+	/**
+	 * Default destructor (no tear-down required).
+	 */
+	virtual ~LatencyHistogram();
+
+	/**
+	 * Discard every recorded value.
+	 */
+	void reset();
+
+	/**
+	 * Record a latency.
+	 *
+	 * @param cycles - the latency in clock cycles
+	 */
+	inline void record(uint64_t cycles)
+	{
+		counts[bucketOf(cycles)]++;
+		if (cycles > maxValue)
+		{
+			maxValue = cycles;
+		}
+	}
+
+	/**
+	 * Add every value recorded by another histogram to this one.
+	 *
+	 * @param other - the histogram to merge
+	 */
+	void add(const LatencyHistogram& other);
+
+	/**
+	 * Retrieve the number of recorded values.
+	 *
+	 * @return number of values
+	 */
+	uint64_t count() const;
+
+	/**
+	 * Retrieve the value at a percentile (the upper bound of the bucket
+	 * that holds it, capped at the maximum).
+	 *
+	 * @param percentile - the percentile (0 to 100)
+	 * @return the value in clock cycles (0 if the histogram is empty)
+	 */
+	uint64_t percentile(double percentile) const;
+
+	/**
+	 * Retrieve the largest recorded value.
+	 *
+	 * @return the maximum in clock cycles
+	 */
+	uint64_t max() const;
+
+	/**
+	 * Format the count, p50, p99, p99.9 and maximum (in microseconds)
+	 * as a comma-separated log line.
+	 *
+	 * @param buffer - the destination buffer
+	 * @param size - the size of the destination buffer
+	 * @param label - the first field of the line
+	 * @param cps - the clock rate of the recorded values
+	 */
+	void format(char* buffer, size_t size, const char* label, uint64_t cps) const;
+
+private:
+	// Bucket layout
+	static const unsigned int SUB_BUCKET_BITS = 7;
+	static const unsigned int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	static const unsigned int HALF_BUCKETS = SUB_BUCKETS / 2;
+	static const unsigned int BUCKETS = SUB_BUCKETS + ((64 - SUB_BUCKET_BITS) * HALF_BUCKETS);
+
+	// Bucket counts and the exact maximum
+	uint32_t counts[BUCKETS];
+	uint64_t maxValue;
+
+	/**
+	 * Map a value to its bucket.
+	 *
+	 * @param value - the value
+	 * @return the bucket index
+	 */
+	static inline unsigned int bucketOf(uint64_t value)
+	{
+		unsigned int shift;
+
+		if (value < SUB_BUCKETS)
+		{
+			return (unsigned int)value;
+		}
+
+		// Keep the top SUB_BUCKET_BITS bits of the value
+		shift = (63 - __builtin_clzll(value)) - SUB_BUCKET_BITS + 1;
+		return SUB_BUCKETS + ((shift - 1) * HALF_BUCKETS) + (unsigned int)((value >> shift) - HALF_BUCKETS);
+	}
+
+	/**
+	 * Retrieve the largest value that maps to a bucket.
+	 *
+	 * @param bucket - the bucket index
+	 * @return the bucket's upper bound
+	 */
+	static uint64_t upperBound(unsigned int bucket);
+};
+
+#endif /* LATENCYHISTOGRAM_H_ */
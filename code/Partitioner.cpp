@@ -0,0 +1,159 @@
+//*****************************************************************
+// Partitioner.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "Partitioner.h"
+#include "Schedulability.h"
+#include <algorithm>
+
+/**
+ * Task ordering for decreasing utilization packing.
+ */
+struct HigherUtilization
+{
+	const vector<TaskData>* taskSet;
+
+	bool operator()(unsigned int a, unsigned int b) const
+	{
+		double ua = (double)(*taskSet)[a].computeTime / (*taskSet)[a].periodTime;
+		double ub = (double)(*taskSet)[b].computeTime / (*taskSet)[b].periodTime;
+		if (ua != ub)
+		{
+			return ua > ub;
+		}
+		return a < b;
+	}
+};
+
+/**
+ * Assign every task of a task set to one of the CPUs.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @param alg - the algorithm each CPU will run
+ * @param numCpus - the number of CPUs to pack onto
+ * @param heuristic - the bin-packing heuristic
+ * @param partitions - set to one partition per CPU
+ * @return false if some task did not fit under the bound (it is
+ *         then placed on the least loaded CPU)
+ */
+bool Partitioner::assign(const vector<TaskData>& taskSet, AlgorithmType alg, unsigned int numCpus,
+		PackingHeuristic heuristic, vector<Partition>& partitions)
+{
+	vector<unsigned int> order;
+	HigherUtilization higher;
+	bool fits = true;
+
+	partitions.clear();
+	partitions.resize(numCpus);
+	for (unsigned int cpu = 0; cpu < numCpus; cpu++)
+	{
+		partitions[cpu].cpu = cpu;
+		partitions[cpu].utilization = 0;
+	}
+
+	// Pack the heaviest tasks first
+	for (unsigned int i = 0; i < taskSet.size(); i++)
+	{
+		order.push_back(i);
+	}
+	higher.taskSet = &taskSet;
+	stable_sort(order.begin(), order.end(), higher);
+
+	for (vector<unsigned int>::iterator itr = order.begin(); itr != order.end(); itr++)
+	{
+		double utilization = (double)taskSet[*itr].computeTime / taskSet[*itr].periodTime;
+		int chosen = -1;
+		unsigned int leastLoaded = 0;
+
+		for (unsigned int cpu = 0; cpu < numCpus; cpu++)
+		{
+			Partition& partition = partitions[cpu];
+			double bound = utilizationBound(alg, partition.taskIDs.size() + 1);
+
+			if (partition.utilization < partitions[leastLoaded].utilization)
+			{
+				leastLoaded = cpu;
+			}
+			if (partition.utilization + utilization > bound)
+			{
+				continue;
+			}
+
+			// First fit stops at the first CPU with room, worst fit keeps
+			// looking for the one with the most room left.
+			if (chosen < 0 || (heuristic == PACKING_WORST_FIT &&
+					partition.utilization < partitions[chosen].utilization))
+			{
+				chosen = cpu;
+				if (heuristic == PACKING_FIRST_FIT)
+				{
+					break;
+				}
+			}
+		}
+
+		// The task set is not provably schedulable on this many CPUs
+		if (chosen < 0)
+		{
+			cerr << "Warning: task " << *itr << " does not fit under the utilization bound of any CPU" << endl;
+			chosen = leastLoaded;
+			fits = false;
+		}
+		partitions[chosen].taskIDs.push_back(*itr);
+		partitions[chosen].utilization += utilization;
+	}
+
+	// Keep each partition's tasks in task ID order
+	for (vector<Partition>::iterator itr = partitions.begin(); itr != partitions.end(); itr++)
+	{
+		sort((*itr).taskIDs.begin(), (*itr).taskIDs.end());
+	}
+
+	return fits;
+}
+
+/**
+ * Retrieve the utilization below which a CPU's tasks are guaranteed
+ * to be schedulable by an algorithm.
+ *
+ * @param alg - the scheduling algorithm
+ * @param numTasks - the number of tasks on the CPU
+ * @return the utilization bound
+ */
+double Partitioner::utilizationBound(AlgorithmType alg, unsigned int numTasks)
+{
+	switch (alg)
+	{
+	case ALGORITHM_TYPE_EDF:
+		return 1.0;
+	case ALGORITHM_TYPE_RMA:
+	case ALGORITHM_TYPE_SCT:
+	default:
+		// Liu & Layland bound n(2^(1/n) - 1); SCT has no known bound, so
+		// it is held to the (conservative) fixed priority one.
+		return Schedulability::liuLaylandBound(numTasks);
+	}
+}
+
+/**
+ * Retrieve the compute/period pairs of the tasks in a partition.
+ *
+ * @param taskSet - the complete task set
+ * @param partition - the partition
+ * @param subset - set to the partition's compute/period pairs
+ */
+void Partitioner::subset(const vector<TaskData>& taskSet, const Partition& partition, vector<TaskData>& subset)
+{
+	subset.clear();
+	for (vector<unsigned int>::const_iterator itr = partition.taskIDs.begin(); itr != partition.taskIDs.end(); itr++)
+	{
+		subset.push_back(taskSet[*itr]);
+	}
+}
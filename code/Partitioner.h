@@ -0,0 +1,77 @@
+//*****************************************************************
+// Partitioner.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef PARTITIONER_H_
+#define PARTITIONER_H_
+
+// Module includes
+#include "Project1.h"
+
+// Enumeration of the bin-packing heuristics used to assign tasks to CPUs
+typedef enum
+{
+	PACKING_FIRST_FIT, // lowest numbered CPU with room (fewest CPUs used)
+	PACKING_WORST_FIT  // least loaded CPU (balanced load)
+} PackingHeuristic;
+
+// The tasks assigned to one CPU
+typedef struct
+{
+	unsigned int cpu;
+	vector<unsigned int> taskIDs;
+	double utilization;
+} Partition;
+
+/**
+ * This class is responsible for partitioning a task set across CPUs.
+ * Tasks are packed in order of decreasing utilization (FFD/WFD) so that
+ * no CPU exceeds the schedulable utilization bound of the algorithm,
+ * and each CPU then schedules its own tasks with that algorithm.
+ *
+ * NOTE: ALL METHODS ARE STATIC
+ */
+class Partitioner
+{
+public:
+	/**
+	 * Assign every task of a task set to one of the CPUs.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param alg - the algorithm each CPU will run
+	 * @param numCpus - the number of CPUs to pack onto
+	 * @param heuristic - the bin-packing heuristic
+	 * @param partitions - set to one partition per CPU
+	 * @return false if some task did not fit under the bound (it is
+	 *         then placed on the least loaded CPU)
+	 */
+	static bool assign(const vector<TaskData>& taskSet, AlgorithmType alg, unsigned int numCpus,
+			PackingHeuristic heuristic, vector<Partition>& partitions);
+
+	/**
+	 * Retrieve the utilization below which a CPU's tasks are guaranteed
+	 * to be schedulable by an algorithm.
+	 *
+	 * @param alg - the scheduling algorithm
+	 * @param numTasks - the number of tasks on the CPU
+	 * @return the utilization bound
+	 */
+	static double utilizationBound(AlgorithmType alg, unsigned int numTasks);
+
+	/**
+	 * Retrieve the compute/period pairs of the tasks in a partition.
+	 *
+	 * @param taskSet - the complete task set
+	 * @param partition - the partition
+	 * @param subset - set to the partition's compute/period pairs
+	 */
+	static void subset(const vector<TaskData>& taskSet, const Partition& partition, vector<TaskData>& subset);
+};
+
+#endif /* PARTITIONER_H_ */
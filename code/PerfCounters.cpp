@@ -0,0 +1,297 @@
+//*****************************************************************
+// PerfCounters.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "PerfCounters.h"
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#endif
+
+// Static member definitions
+bool PerfCounters::enabled = false;
+const uint64_t PerfCounters::NO_COUNT;
+
+#ifdef __linux__
+// The event of each counter (in CounterType order)
+static const struct
+{
+	uint32_t type;
+	uint64_t config;
+} COUNTER_EVENTS[COUNTER_LAST_ENTRY] =
+{
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+	{ PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES },
+	{ PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS }
+};
+
+/**
+ * Read a hardware counter of the calling thread with rdpmc, following
+ * the seqlock protocol of the counter's mapped user page.
+ *
+ * @param page - the counter's mapped user page
+ * @param value - set to the counter value
+ * @return true if the counter was read (false if rdpmc is not allowed or
+ *         the counter is not active)
+ */
+static bool readPmc(volatile struct perf_event_mmap_page* page, uint64_t& value)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	uint32_t seq;
+	uint32_t index;
+	uint32_t lo;
+	uint32_t hi;
+	uint16_t width;
+	int64_t count;
+	int64_t pmc;
+
+	do
+	{
+		seq = page->lock;
+		__asm__ __volatile__("" ::: "memory");
+		index = page->index;
+		if (!page->cap_user_rdpmc || index == 0)
+		{
+			return false;
+		}
+		count = page->offset;
+		width = page->pmc_width;
+		__asm__ __volatile__("rdpmc" : "=a"(lo), "=d"(hi) : "c"(index - 1));
+
+		// Sign-extend the counter from its hardware width
+		pmc = (int64_t)((((uint64_t)hi << 32) | lo) << (64 - width)) >> (64 - width);
+		count += pmc;
+		__asm__ __volatile__("" ::: "memory");
+	}
+	while (page->lock != seq);
+
+	value = count;
+	return true;
+#else
+	(void)page;
+	(void)value;
+	return false;
+#endif
+}
+#endif
+
+/**
+ * Default constructor for a closed counter group.
+ */
+PerfCounters::PerfCounters()
+{
+	for (int i = 0; i < COUNTER_LAST_ENTRY; i++)
+	{
+		fds[i] = -1;
+		pages[i] = NULL;
+		base[i] = 0;
+	}
+	owner = pthread_self();
+}
+
+/**
+ * Default destructor that closes the counter group.
+ */
+PerfCounters::~PerfCounters()
+{
+	close();
+}
+
+/**
+ * Open the counter group for the calling thread (if counters are
+ * enabled and the group is not open yet).
+ *
+ * @return true if at least one counter was opened
+ */
+bool PerfCounters::open()
+{
+	bool opened = false;
+
+	if (!enabled)
+	{
+		return false;
+	}
+
+#ifdef __linux__
+	struct perf_event_attr attr;
+	int leader = -1;
+
+	// A pooled task thread keeps its group from one test to the next
+	for (int i = 0; i < COUNTER_LAST_ENTRY; i++)
+	{
+		if (fds[i] >= 0)
+		{
+			return true;
+		}
+	}
+
+	owner = pthread_self();
+	for (int i = 0; i < COUNTER_LAST_ENTRY; i++)
+	{
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = COUNTER_EVENTS[i].type;
+		attr.config = COUNTER_EVENTS[i].config;
+		attr.exclude_hv = 1;
+
+		// Count kernel events too if allowed (context switches are
+		// kernel events), otherwise only user events
+		fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+		if (fds[i] < 0)
+		{
+			attr.exclude_kernel = 1;
+			fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+		}
+		if (fds[i] < 0)
+		{
+			continue;
+		}
+
+		// The first counter opened leads the group, and each hardware
+		// counter maps its user page for rdpmc
+		if (leader < 0)
+		{
+			leader = fds[i];
+		}
+		if (attr.type == PERF_TYPE_HARDWARE)
+		{
+			pages[i] = mmap(NULL, sysconf(_SC_PAGESIZE), PROT_READ, MAP_SHARED, fds[i], 0);
+			if (pages[i] == MAP_FAILED)
+			{
+				pages[i] = NULL;
+			}
+		}
+		opened = true;
+	}
+#endif
+
+	return opened;
+}
+
+/**
+ * Close the counter group.
+ */
+void PerfCounters::close()
+{
+#ifdef __linux__
+	// Close the group leader last
+	for (int i = COUNTER_LAST_ENTRY - 1; i >= 0; i--)
+	{
+		if (pages[i] != NULL)
+		{
+			munmap(pages[i], sysconf(_SC_PAGESIZE));
+			pages[i] = NULL;
+		}
+		if (fds[i] >= 0)
+		{
+			::close(fds[i]);
+			fds[i] = -1;
+		}
+	}
+#endif
+}
+
+/**
+ * Start counting a schedule test: later counts are relative to now.
+ */
+void PerfCounters::start()
+{
+	sample(base);
+}
+
+/**
+ * Append the counts since start() to a data line as comma-separated
+ * columns in CounterType order (nothing if counters are disabled).
+ *
+ * @param data - the data line
+ * @param size - the size of the data line buffer
+ */
+void PerfCounters::format(char* data, size_t size)
+{
+	uint64_t values[COUNTER_LAST_ENTRY];
+	size_t length = strlen(data);
+
+	if (!enabled)
+	{
+		return;
+	}
+
+	sample(values);
+	for (int i = 0; i < COUNTER_LAST_ENTRY && length < size; i++)
+	{
+		if (values[i] == NO_COUNT || base[i] == NO_COUNT)
+		{
+			length += snprintf(data + length, size - length, ",-1");
+		}
+		else
+		{
+			length += snprintf(data + length, size - length, ",%" PRIu64, values[i] - base[i]);
+		}
+	}
+}
+
+/**
+ * Enable or disable the counters of every thread opened from now on.
+ *
+ * @param enable - true to enable the counters
+ */
+void PerfCounters::setEnabled(bool enable)
+{
+	enabled = enable;
+}
+
+/**
+ * Check whether counters are enabled.
+ *
+ * @return true if counters are enabled
+ */
+bool PerfCounters::isEnabled()
+{
+	return enabled;
+}
+
+/**
+ * Read the current value of every counter.
+ *
+ * @param values - filled with each counter's value (NO_COUNT if unavailable)
+ */
+void PerfCounters::sample(uint64_t* values)
+{
+	bool ownThread = pthread_equal(pthread_self(), owner);
+
+	for (int i = 0; i < COUNTER_LAST_ENTRY; i++)
+	{
+		values[i] = NO_COUNT;
+#ifdef __linux__
+		if (fds[i] < 0)
+		{
+			continue;
+		}
+
+		// rdpmc only reads the counters of the calling thread
+		if (ownThread && pages[i] != NULL &&
+				readPmc((volatile struct perf_event_mmap_page*)pages[i], values[i]))
+		{
+			continue;
+		}
+		if (read(fds[i], &values[i], sizeof(values[i])) != sizeof(values[i]))
+		{
+			values[i] = NO_COUNT;
+		}
+#else
+		(void)ownThread;
+#endif
+	}
+}
@@ -0,0 +1,121 @@
+//*****************************************************************
+// PerfCounters.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef PERFCOUNTERS_H_
+#define PERFCOUNTERS_H_
+
+// Module includes
+#include "Project1.h"
+#include <pthread.h>
+
+// Enumeration of the counters in a counter group (in data line order)
+typedef enum
+{
+	COUNTER_CYCLES,
+	COUNTER_INSTRUCTIONS,
+	COUNTER_CACHE_MISSES,
+	COUNTER_CONTEXT_SWITCHES,
+	COUNTER_MIGRATIONS,
+	COUNTER_LAST_ENTRY
+} CounterType;
+
+/**
+ * This class holds a group of performance counters (CPU cycles,
+ * instructions, cache misses, context switches and CPU migrations) that
+ * count the events of one thread, so a deadline miss can be traced back to
+ * cache thrashing, preemptions or migrations. On Linux the group is opened
+ * with perf_event_open; the hardware counters are read with rdpmc (no
+ * system call) when the owning thread reads them and the kernel allows it,
+ * and with read() otherwise. Counters that the platform or the permissions
+ * do not provide are reported as -1.
+ *
+ * Counters are optional: they are only opened if enabled with setEnabled().
+ */
+class PerfCounters
+{
+public:
+	/**
+	 * Default constructor for a closed counter group.
+	 */
+	PerfCounters();
+
+	/**
+	 * Default destructor that closes the counter group.
+	 */
+	~PerfCounters();
+
+	/**
+	 * Open the counter group for the calling thread (if counters are
+	 * enabled and the group is not open yet).
+	 *
+	 * @return true if at least one counter was opened
+	 */
+	bool open();
+
+	/**
+	 * Close the counter group.
+	 */
+	void close();
+
+	/**
+	 * Start counting a schedule test: later counts are relative to now.
+	 */
+	void start();
+
+	/**
+	 * Append the counts since start() to a data line as comma-separated
+	 * columns in CounterType order (nothing if counters are disabled).
+	 *
+	 * @param data - the data line
+	 * @param size - the size of the data line buffer
+	 */
+	void format(char* data, size_t size);
+
+	/**
+	 * Enable or disable the counters of every thread opened from now on.
+	 *
+	 * @param enable - true to enable the counters
+	 */
+	static void setEnabled(bool enable);
+
+	/**
+	 * Check whether counters are enabled.
+	 *
+	 * @return true if counters are enabled
+	 */
+	static bool isEnabled();
+
+private:
+	/**
+	 * Read the current value of every counter.
+	 *
+	 * @param values - filled with each counter's value (NO_COUNT if unavailable)
+	 */
+	void sample(uint64_t* values);
+
+	// File descriptor (-1 if not open) and mapped user page (NULL if
+	// not mapped) of each counter
+	int fds[COUNTER_LAST_ENTRY];
+	void* pages[COUNTER_LAST_ENTRY];
+
+	// The thread that the counters count (and may read them with rdpmc)
+	pthread_t owner;
+
+	// Counter values when the schedule test started
+	uint64_t base[COUNTER_LAST_ENTRY];
+
+	// Boolean flag indicating whether counters are enabled
+	static bool enabled;
+
+	// Value of a counter that is not available
+	static const uint64_t NO_COUNT = ~0ULL;
+};
+
+#endif /* PERFCOUNTERS_H_ */
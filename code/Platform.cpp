@@ -0,0 +1,347 @@
+//*****************************************************************
+// Platform.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "Platform.h"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+
+#ifndef __QNX__
+#include <sys/mman.h>
+#endif
+
+// Static member definitions
+uint64_t Platform::cps = 1000000000ULL;
+bool Platform::useTsc = false;
+int Platform::traceFd = -1;
+
+// Private constants
+#define CALIBRATION_NS (100000000ULL) // 100ms calibration window
+#define NS_PER_SEC     (1000000000ULL)
+
+#ifndef __QNX__
+// Candidate locations of the ftrace marker file used as the Linux trace sink
+static const char* TRACE_MARKERS[] =
+{
+	"/sys/kernel/tracing/trace_marker",
+	"/sys/kernel/debug/tracing/trace_marker",
+	NULL
+};
+
+/**
+ * Determine whether the CPU advertises an invariant TSC, which is the
+ * only case where the TSC is safe to use as a cycle counter.
+ *
+ * @return true if the TSC is invariant
+ */
+static bool invariantTsc()
+{
+	char line[4096];
+	bool constant = false;
+	bool nonstop = false;
+	FILE* cpuinfo = fopen("/proc/cpuinfo", "r");
+
+	if (cpuinfo == NULL)
+	{
+		return false;
+	}
+	while (fgets(line, sizeof(line), cpuinfo) != NULL)
+	{
+		if (strncmp(line, "flags", 5) == 0)
+		{
+			constant = (strstr(line, " constant_tsc") != NULL);
+			nonstop = (strstr(line, " nonstop_tsc") != NULL);
+			break;
+		}
+	}
+	fclose(cpuinfo);
+
+	return constant && nonstop;
+}
+#endif
+
+/**
+ * Perform the one-time platform initialization: acquire I/O privileges,
+ * calibrate the cycle counter and spin primitive and open the trace sink.
+ * Must be called once before any other method.
+ */
+void Platform::calibrate()
+{
+#ifdef __QNX__
+	ThreadCtl(_NTO_TCTL_IO, NULL); // Get I/O privileges first
+	nanospin_calibrate(1); // EINTR = 4 -> too many interrupts during calibration
+	cps = SYSPAGE_ENTRY(qtime)->cycles_per_sec;
+#else
+	uint64_t startNs;
+	uint64_t endNs;
+	uint64_t startCycles;
+	uint64_t endCycles;
+
+	// Keep page faults out of the measured compute cycles.
+	mlockall(MCL_CURRENT | MCL_FUTURE);
+
+#if defined(__x86_64__) || defined(__i386__)
+	useTsc = invariantTsc();
+#endif
+
+	if (useTsc)
+	{
+		// Measure the TSC rate against the raw monotonic clock.
+		startNs = monotonicNanoseconds();
+		startCycles = clockCycles();
+		do
+		{
+			endNs = monotonicNanoseconds();
+		}
+		while ((endNs - startNs) < CALIBRATION_NS);
+		endCycles = clockCycles();
+		cps = ((endCycles - startCycles) * NS_PER_SEC) / (endNs - startNs);
+	}
+	else
+	{
+		cps = NS_PER_SEC;
+	}
+
+	// Open the first available ftrace marker as the trace sink.
+	for (int i = 0; TRACE_MARKERS[i] != NULL && traceFd < 0; i++)
+	{
+		traceFd = open(TRACE_MARKERS[i], O_WRONLY);
+	}
+#endif
+}
+
+/**
+ * Set the resolution of the system clock that drives all timers.
+ *
+ * @param ns - clock resolution in nanoseconds
+ */
+void Platform::setClockResolution(unsigned long ns)
+{
+#ifdef __QNX__
+	struct _clockperiod period;
+	period.fract = 0;
+	period.nsec = ns;
+	ClockPeriod(CLOCK_REALTIME, &period, NULL, 0);
+#else
+	(void)ns; // high-resolution timers are always enabled on Linux
+#endif
+}
+
+/**
+ * Retrieve the calibrated rate of the cycle counter.
+ *
+ * @return cycles per second
+ */
+uint64_t Platform::cyclesPerSec()
+{
+	return cps;
+}
+
+/**
+ * Retrieve the model name of the CPU (used to key per-machine
+ * calibration data).
+ *
+ * @return CPU model name, or "unknown" if it is not available
+ */
+string Platform::cpuModel()
+{
+	string model = "unknown";
+#ifdef __QNX__
+	model = SYSPAGE_ENTRY(strings)->data + SYSPAGE_ENTRY(cpuinfo)->name;
+#else
+	char line[4096];
+	char* value;
+	FILE* cpuinfo = fopen("/proc/cpuinfo", "r");
+
+	if (cpuinfo == NULL)
+	{
+		return model;
+	}
+	while (fgets(line, sizeof(line), cpuinfo) != NULL)
+	{
+		if (strncmp(line, "model name", 10) == 0 && (value = strchr(line, ':')) != NULL)
+		{
+			// Skip the separator and drop the newline
+			model = value + 1 + strspn(value + 1, " \t");
+			model.erase(model.find_last_not_of("\r\n") + 1);
+			break;
+		}
+	}
+	fclose(cpuinfo);
+#endif
+	return model;
+}
+
+/**
+ * Busy-wait (without yielding the CPU) for the given amount of time.
+ *
+ * @param when - the amount of time to spin
+ * @return 0 on success, an errno value otherwise
+ */
+int Platform::spin(const struct timespec* when)
+{
+#ifdef __QNX__
+	return nanospin(when);
+#else
+	uint64_t ns = ((uint64_t)when->tv_sec * NS_PER_SEC) + when->tv_nsec;
+	uint64_t target = clockCycles() + ((ns * cps) / NS_PER_SEC);
+	while (clockCycles() < target)
+	{
+		// Burn and churn.
+	}
+	return 0;
+#endif
+}
+
+/**
+ * Retrieve the scheduling policy used for every real-time thread.
+ *
+ * @return SCHED_RR on QNX, SCHED_FIFO on Linux
+ */
+int Platform::schedPolicy()
+{
+#ifdef __QNX__
+	return SCHED_RR;
+#else
+	return SCHED_FIFO;
+#endif
+}
+
+/**
+ * Retrieve the lowest priority that real-time test threads may use.
+ *
+ * @param thread - the thread whose current priority serves as a base
+ * @return base real-time priority
+ */
+int Platform::basePriority(pthread_t thread)
+{
+#ifdef __QNX__
+	int pol;
+	struct sched_param param;
+	pthread_getschedparam(thread, &pol, &param);
+	return param.sched_priority;
+#else
+	// Normal Linux threads have no real-time priority, so start at the
+	// bottom of the SCHED_FIFO range.
+	(void)thread;
+	return sched_get_priority_min(SCHED_FIFO);
+#endif
+}
+
+/**
+ * Assign a real-time priority to a thread, clamping it to the range
+ * supported by the platform's real-time policy.
+ *
+ * @param thread - the thread to modify
+ * @param param - schedule parameter structure holding the new priority
+ * @return 0 on success, an errno value otherwise
+ */
+int Platform::setPriority(pthread_t thread, struct sched_param* param)
+{
+	int policy = schedPolicy();
+	int minPriority = sched_get_priority_min(policy);
+	int maxPriority = sched_get_priority_max(policy);
+
+	if (param->sched_priority < minPriority)
+	{
+		param->sched_priority = minPriority;
+	}
+	else if (param->sched_priority > maxPriority)
+	{
+		param->sched_priority = maxPriority;
+	}
+
+	return pthread_setschedparam(thread, policy, param);
+}
+
+/**
+ * Retrieve the number of CPUs available to the test.
+ *
+ * @return number of online CPUs
+ */
+unsigned int Platform::numCpus()
+{
+#ifdef __QNX__
+	return _syspage_ptr->num_cpu;
+#else
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	return (cpus > 0) ? (unsigned int)cpus : 1;
+#endif
+}
+
+/**
+ * Restrict the calling thread to a single CPU.
+ *
+ * @param cpu - the CPU index (0 to numCpus() - 1)
+ * @return 0 on success, an errno value otherwise
+ */
+int Platform::bindToCpu(unsigned int cpu)
+{
+#ifdef __QNX__
+	// The run mask only ever applies to the calling thread
+	if (ThreadCtl(_NTO_TCTL_RUNMASK, (void*)(uintptr_t)(1U << cpu)) == -1)
+	{
+		return errno;
+	}
+	return 0;
+#else
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+/**
+ * Insert a simple user event into the kernel trace stream.
+ *
+ * @param event - the event type
+ * @param data - the integer payload (typically a task ID)
+ */
+void Platform::traceEvent(EventType event, int data)
+{
+#ifdef __QNX__
+	TraceEvent(_NTO_TRACE_INSERTSUSEREVENT, event, event, data);
+#else
+	char buffer[32];
+	int length;
+
+	if (traceFd >= 0)
+	{
+		length = snprintf(buffer, sizeof(buffer), "EVENT %d %d\n", event, data);
+		write(traceFd, buffer, length);
+	}
+#endif
+}
+
+/**
+ * Insert a string user event into the kernel trace stream.
+ *
+ * @param event - the event type
+ * @param data - the string payload
+ */
+void Platform::traceString(EventType event, const char* data)
+{
+#ifdef __QNX__
+	TraceEvent(_NTO_TRACE_INSERTUSRSTREVENT, event, data);
+#else
+	char buffer[32];
+	int length;
+
+	if (traceFd >= 0)
+	{
+		length = snprintf(buffer, sizeof(buffer), "EVENT %d ", event);
+		write(traceFd, buffer, length);
+		write(traceFd, data, strlen(data));
+		write(traceFd, "\n", 1);
+	}
+#endif
+}
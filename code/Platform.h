@@ -0,0 +1,173 @@
+//*****************************************************************
+// Platform.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef PLATFORM_H_
+#define PLATFORM_H_
+
+// Module includes
+#include "Project1.h"
+#include <pthread.h>
+
+/**
+ * This class wraps every OS-specific primitive used by the schedule test
+ * (cycle counter, calibrated spin, priority management and the kernel
+ * trace stream) so that the tasks and the proxy scheduler can run on
+ * both QNX Neutrino and Linux. On QNX each method maps directly to the
+ * native call; on Linux the cycle counter is the TSC (or CLOCK_MONOTONIC_RAW
+ * when no TSC is available) calibrated against the monotonic clock.
+ *
+ * NOTE: ALL METHODS ARE STATIC
+ */
+class Platform
+{
+public:
+	/**
+	 * Perform the one-time platform initialization: acquire I/O privileges,
+	 * calibrate the cycle counter and spin primitive and open the trace sink.
+	 * Must be called once before any other method.
+	 */
+	static void calibrate();
+
+	/**
+	 * Set the resolution of the system clock that drives all timers.
+	 *
+	 * @param ns - clock resolution in nanoseconds
+	 */
+	static void setClockResolution(unsigned long ns);
+
+	/**
+	 * Read the free-running cycle counter.
+	 *
+	 * @return current cycle count
+	 */
+	static inline uint64_t clockCycles()
+	{
+#if defined(__QNX__)
+		return ClockCycles();
+#elif defined(__x86_64__) || defined(__i386__)
+		if (useTsc)
+		{
+			uint32_t lo, hi;
+			__asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+			return ((uint64_t)hi << 32) | lo;
+		}
+		return monotonicNanoseconds();
+#else
+		return monotonicNanoseconds();
+#endif
+	}
+
+	/**
+	 * Retrieve the calibrated rate of the cycle counter.
+	 *
+	 * @return cycles per second
+	 */
+	static uint64_t cyclesPerSec();
+
+	/**
+	 * Retrieve the model name of the CPU (used to key per-machine
+	 * calibration data).
+	 *
+	 * @return CPU model name, or "unknown" if it is not available
+	 */
+	static string cpuModel();
+
+	/**
+	 * Busy-wait (without yielding the CPU) for the given amount of time.
+	 *
+	 * @param when - the amount of time to spin
+	 * @return 0 on success, an errno value otherwise
+	 */
+	static int spin(const struct timespec* when);
+
+	/**
+	 * Retrieve the scheduling policy used for every real-time thread.
+	 *
+	 * @return SCHED_RR on QNX, SCHED_FIFO on Linux
+	 */
+	static int schedPolicy();
+
+	/**
+	 * Retrieve the lowest priority that real-time test threads may use.
+	 *
+	 * @param thread - the thread whose current priority serves as a base
+	 * @return base real-time priority
+	 */
+	static int basePriority(pthread_t thread);
+
+	/**
+	 * Assign a real-time priority to a thread, clamping it to the range
+	 * supported by the platform's real-time policy.
+	 *
+	 * @param thread - the thread to modify
+	 * @param param - schedule parameter structure holding the new priority
+	 * @return 0 on success, an errno value otherwise
+	 */
+	static int setPriority(pthread_t thread, struct sched_param* param);
+
+	/**
+	 * Retrieve the number of CPUs available to the test.
+	 *
+	 * @return number of online CPUs
+	 */
+	static unsigned int numCpus();
+
+	/**
+	 * Restrict the calling thread to a single CPU.
+	 *
+	 * @param cpu - the CPU index (0 to numCpus() - 1)
+	 * @return 0 on success, an errno value otherwise
+	 */
+	static int bindToCpu(unsigned int cpu);
+
+	/**
+	 * Insert a simple user event into the kernel trace stream.
+	 *
+	 * @param event - the event type
+	 * @param data - the integer payload (typically a task ID)
+	 */
+	static void traceEvent(EventType event, int data);
+
+	/**
+	 * Insert a string user event into the kernel trace stream.
+	 *
+	 * @param event - the event type
+	 * @param data - the string payload
+	 */
+	static void traceString(EventType event, const char* data);
+
+private:
+	// Calibrated cycle counter rate
+	static uint64_t cps;
+
+	// Boolean flag indicating whether the TSC is used as the cycle counter
+	static bool useTsc;
+
+	// File descriptor of the trace sink (-1 if no sink is available)
+	static int traceFd;
+
+	/**
+	 * Read CLOCK_MONOTONIC_RAW in nanoseconds.
+	 *
+	 * @return monotonic time in nanoseconds
+	 */
+	static inline uint64_t monotonicNanoseconds()
+	{
+		struct timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+		clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+		return ((uint64_t)ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+	}
+};
+
+#endif /* PLATFORM_H_ */
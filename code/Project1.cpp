@@ -12,46 +12,87 @@
 #include "Project1.h"
 #include "Task.h"
 #include "ProxyScheduler.h"
+#include "Platform.h"
+#include "Simulator.h"
+#include "TraceFile.h"
+#include "Partitioner.h"
+#include "Schedulability.h"
+#include "TaskPool.h"
+#include "SpinQuantum.h"
+#include "PerfCounters.h"
+#include "StatsExport.h"
+#include <fstream>
 
 // Private constants
 #define CLOCK_RESOLUTION (50000)
 #define PRIORITY_OFFSET  (5)
+#define QUANTUM_CACHE    "quantum.cache"
+
+// The command line options that apply to every schedule test
+typedef struct
+{
+	bool simulate;
+	bool partitioned;
+	bool global;
+	bool analyze;
+	bool topOnly;
+	unsigned int tableKBytes;
+	unsigned int numCpus;
+	PackingHeuristic heuristic;
+	const char* statsName;
+} TestOptions;
 
 /**
- * The main entry point into the application.
+ * Read one schedule test (the algorithm choice, test runtime and task
+ * set) from a stream.
+ *
+ * @param in - the stream (stdin, or a batch manifest)
+ * @param prompt - true to prompt for each value on stdout
+ * @param algorithm - set to the algorithm choice
+ * @param testRuntime - set to the test runtime (s)
+ * @param tasks - set to the task compute/period pairs
+ * @return false if the stream ended before a whole test was read
  */
-int main(int argc, char *argv[])
+static bool readTest(istream& in, bool prompt, int& algorithm, int& testRuntime, vector<TaskData>& tasks)
 {
-	int testRuntime = 0;
 	int numTasks = 0;
-	int taskID = 0;
 	int computeTime = 0;
 	int periodTime = 0;
-	int pol = 0;
-	int algorithm = 0;
-	struct _clockperiod period;
-	vector<TaskData> tasks;
-	ProxyScheduler* scheduler;
-	struct sched_param schedParam;
 
-	// Read in the algorithm selection from stdin and do a quick validation
-	cout << "Algorithm choice: ";
-	cin >> algorithm;
+	// Read in the algorithm selection and do a quick validation
+	if (prompt)
+	{
+		cout << "Algorithm choice: ";
+	}
+	if (!(in >> algorithm))
+	{
+		return false;
+	}
 	assert(algorithm >= ALGORITHM_TYPE_RMA && algorithm < ALGORITHM_TYPE_LAST_ENTRY);
 
-	// Read in text fixture parameters from stdin
-	cout << "Test runtime: ";
-	cin >> testRuntime;
-	cout << "Number of tasks: ";
-	cin >> numTasks;
+	// Read in text fixture parameters
+	if (prompt)
+	{
+		cout << "Test runtime: ";
+	}
+	in >> testRuntime;
+	if (prompt)
+	{
+		cout << "Number of tasks: ";
+	}
+	in >> numTasks;
 
-	// Read in task parameters from stdin
-	cout << "Task data ([c,p] pairs):" << endl;
+	// Read in task parameters
+	if (prompt)
+	{
+		cout << "Task data ([c,p] pairs):" << endl;
+	}
+	tasks.clear();
 	for (int count = 0; count < numTasks; count++)
 	{
 		// Read in this individual task's parameters (compute-period pair).
-		cin >> computeTime;
-		cin >> periodTime;
+		in >> computeTime;
+		in >> periodTime;
 		assert(computeTime <= periodTime); // just to be safe
 
 		// Push a new task object into the list.
@@ -61,26 +102,396 @@ int main(int argc, char *argv[])
 		tasks.push_back(data);
 	}
 
-	// Calibrate timing for nanospin
-	ThreadCtl(_NTO_TCTL_IO, NULL); // Get I/O privileges first
-	nanospin_calibrate(1); // EINTR = 4 -> too many interrupts during calibration
+	return !in.fail();
+}
+
+/**
+ * Run one schedule test (live or simulated, on one CPU, partitioned or
+ * global) and log the collected data to stdout. The cycle counter must
+ * already be calibrated.
+ *
+ * @param options - the command line options
+ * @param algorithm - the algorithm choice
+ * @param testRuntime - the test runtime (s)
+ * @param tasks - the task compute/period pairs
+ * @param pool - the pool the task threads are taken from (NULL to create them)
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if the test was rejected
+ */
+static int runTest(const TestOptions& options, int algorithm, int testRuntime, const vector<TaskData>& tasks,
+		TaskPool* pool)
+{
+	int taskID = 0;
+	int basePriority = 0;
+	unsigned int numCpus = options.numCpus;
+	vector<TaskData> partitionTasks;
+	vector<Partition> partitions;
+	vector<ProxyScheduler*> schedulers;
+	SchedAnalysis analysis;
+	bool infeasible = false;
+	ProxyScheduler* scheduler;
+	Simulator* simulator;
+	StatsExport stats;
+
+	if (options.topOnly && algorithm == ALGORITHM_TYPE_RMA)
+	{
+		cerr << "Top-only dispatch (-d) requires EDF or SCT" << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Preallocate the schedule trace (shared by every partition) for the whole test.
+	scheduleTrace.reset(TraceBuffer::estimateCapacity(tasks, testRuntime));
 
-	// Set the clock resolution to 0.5ms (sufficient for our tests).
-	period.fract = 0;
-	period.nsec = CLOCK_RESOLUTION;
-	ClockPeriod(CLOCK_REALTIME, &period, NULL, 0);
+	// Either pack the tasks onto the CPUs or keep them all in one set that is
+	// scheduled on one CPU (pinned to CPU 0, as on a uniprocessor), or globally
+	// on several (unpinned).
+	if ((options.partitioned || options.global) && numCpus == 0)
+	{
+		numCpus = Platform::numCpus();
+	}
+	if (options.partitioned)
+	{
+		Partitioner::assign(tasks, (AlgorithmType)algorithm, numCpus, options.heuristic, partitions);
+		for (vector<Partition>::iterator itr = partitions.begin(); itr != partitions.end(); itr++)
+		{
+			cout << "PARTITION " << (*itr).cpu << "," << (*itr).utilization << ",";
+			for (vector<unsigned int>::iterator id = (*itr).taskIDs.begin(); id != (*itr).taskIDs.end(); id++)
+			{
+				cout << *id << ",";
+			}
+			cout << endl;
+		}
+	}
+	else
+	{
+		if (options.global)
+		{
+			cout << "GLOBAL " << numCpus << endl;
+		}
+		partitions.resize(1);
+		partitions[0].cpu = 0;
+		partitions[0].utilization = 0;
+		for (unsigned int i = 0; i < tasks.size(); i++)
+		{
+			partitions[0].taskIDs.push_back(i);
+		}
+	}
 
-	// Give the proxy scheduler the highest priority and then start it.
-	scheduler = new ProxyScheduler((AlgorithmType)algorithm, tasks, testRuntime, taskID++);
-	pthread_getschedparam(scheduler->threadID(), &pol, &schedParam);
-	scheduler->setPriority(schedParam.sched_priority);
-	schedParam.sched_priority = schedParam.sched_priority + tasks.size() + PRIORITY_OFFSET;
-	pthread_setschedparam(scheduler->threadID(), SCHED_RR, &schedParam);
-	scheduler->start();
+	// Reject the task set before running it if some partition is provably infeasible.
+	if (options.analyze)
+	{
+		for (vector<Partition>::iterator itr = partitions.begin(); itr != partitions.end(); itr++)
+		{
+			Partitioner::subset(tasks, *itr, partitionTasks);
+			if (Schedulability::analyze(partitionTasks, (AlgorithmType)algorithm, analysis) == SCHED_INFEASIBLE)
+			{
+				infeasible = true;
+			}
+			cout << "SCHED " << (*itr).cpu << "," << Schedulability::verdictName(analysis.verdict) << "," <<
+					analysis.utilization << "," << analysis.liuLayland << "," << analysis.hyperbolic << endl;
+			for (unsigned int i = 0; i < partitionTasks.size(); i++)
+			{
+				cout << "WCRT " << (*itr).taskIDs[i] << ",";
+				if (analysis.responseTimes[i] == Schedulability::NO_BOUND)
+				{
+					cout << "inf" << endl;
+				}
+				else
+				{
+					cout << analysis.responseTimes[i] << endl;
+				}
+			}
+		}
+		if (infeasible)
+		{
+			cerr << "The task set is not schedulable." << endl;
+			return EXIT_FAILURE;
+		}
+	}
 
-	// Wait until the proxy scheduler terminates before cleaning up.
-	scheduler->join();
+	// Run the test offline in virtual time if requested (one partition at a time).
+	if (options.simulate)
+	{
+		for (vector<Partition>::iterator itr = partitions.begin(); itr != partitions.end(); itr++)
+		{
+			if ((*itr).taskIDs.empty())
+			{
+				continue;
+			}
+			Partitioner::subset(tasks, *itr, partitionTasks);
+			simulator = new Simulator((AlgorithmType)algorithm, partitionTasks, testRuntime, (*itr).taskIDs,
+					options.global ? numCpus : 1);
+			simulator->run();
+			delete simulator;
+		}
+	}
+	else
+	{
+		// Set the clock resolution to 0.5ms (sufficient for our tests).
+		Platform::setClockResolution(CLOCK_RESOLUTION);
+		basePriority = Platform::basePriority(pthread_self());
+
+		// Publish the live statistics of every task and proxy scheduler if requested.
+		if (options.statsName != NULL && !stats.create(options.statsName, tasks.size(), partitions.size()))
+		{
+			cerr << "Error creating the live statistics region " << options.statsName << endl;
+			return EXIT_FAILURE;
+		}
+
+		// Give each proxy scheduler the highest priority and then start it
+		// (on its partition's CPU unless the tasks are scheduled globally; its
+		// tasks and timer dispatcher share that CPU).
+		for (vector<Partition>::iterator itr = partitions.begin(); itr != partitions.end(); itr++)
+		{
+			if ((*itr).taskIDs.empty())
+			{
+				continue;
+			}
+			Partitioner::subset(tasks, *itr, partitionTasks);
+			scheduler = new ProxyScheduler((AlgorithmType)algorithm, partitionTasks, testRuntime,
+					taskID++, (*itr).taskIDs, options.global ? numCpus : 1);
+			scheduler->setPriority(basePriority);
+			scheduler->setDispatchTopOnly(options.topOnly);
+			scheduler->setGlobal(options.global);
+			scheduler->setTableBudget((uint64_t)options.tableKBytes * 1024);
+			scheduler->setTaskPool(pool);
+			scheduler->setStatsExport(options.statsName != NULL ? &stats : NULL, schedulers.size());
+			if (!options.global)
+			{
+				scheduler->setCpu((*itr).cpu);
+			}
+			scheduler->setStartPriority(basePriority + partitionTasks.size() + PRIORITY_OFFSET);
+			scheduler->start();
+			schedulers.push_back(scheduler);
+		}
+
+		// Wait until every proxy scheduler terminates before cleaning up.
+		for (vector<ProxyScheduler*>::iterator itr = schedulers.begin(); itr != schedulers.end(); itr++)
+		{
+			(*itr)->join();
+			delete(*itr);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * Calibrate the cycle counter and spin primitive, and (for live tests)
+ * the spin time of each task's compute quantum.
+ *
+ * @param options - the command line options
+ * @param cacheFile - the spin quantum calibration cache file
+ */
+static void calibrate(const TestOptions& options, const char* cacheFile)
+{
+	bool cached;
+
+	Platform::calibrate();
+	if (!options.simulate)
+	{
+		cached = SpinQuantum::calibrate(Task::TIME_QUANTUM, cacheFile);
+		cout << "QUANTUM " << SpinQuantum::spinTime() << "," << SpinQuantum::overhead() << "," <<
+				SpinQuantum::accuracy() << "," << cached << endl;
+	}
+}
+
+/**
+ * The main entry point into the application.
+ *
+ * Options:
+ *   -s       simulate the schedule test in virtual time instead of running it live
+ *   -t file  also write the schedule trace to a binary trace file
+ *   -p cpus  partition the tasks across cpus CPUs (0 for every online CPU),
+ *            running one proxy scheduler pinned to each CPU
+ *   -w       partition with worst fit (balanced load) instead of first fit
+ *   -g cpus  schedule the tasks globally on cpus CPUs (0 for every online CPU):
+ *            the cpus highest priority tasks run at once and migrate between
+ *            CPUs, and each CPU reschedules the events its own timers fire
+ *            (with -d or -c one proxy scheduler still does)
+ *   -a       analyze the schedulability of the task set (of each partition)
+ *            first and do not run it if it is provably infeasible
+ *   -d       dispatch only the top task of each CPU on each schedule event
+ *            (EDF and SCT, live tests only)
+ *   -c kb    replay a cyclic-executive table of the algorithm, compiled offline
+ *            over one hyperperiod, if it fits in kb kilobytes (live tests only;
+ *            falls back to online scheduling otherwise)
+ *   -b file  run every schedule test of a manifest file (each test in the
+ *            format read from stdin: algorithm, runtime, task count and
+ *            [c,p] pairs) without prompts, calibrating once and reusing
+ *            the task threads from one test to the next
+ *   -q file  cache the spin quantum calibration in file (default quantum.cache),
+ *            keyed by CPU model and cycle counter rate
+ *   -e       count the cycles, instructions, cache misses, context switches and
+ *            CPU migrations of each task and proxy scheduler thread, appended
+ *            to the TDATA/PDATA lines (live tests only; -1 if not available)
+ *   -x name  publish the live statistics of each test in the shared-memory
+ *            object name (e.g. /project1) while it runs (live tests only;
+ *            see tools/StatsMonitor)
+ */
+int main(int argc, char *argv[])
+{
+	int testRuntime = 0;
+	int algorithm = 0;
+	int option = 0;
+	int result = EXIT_SUCCESS;
+	unsigned int experiment = 0;
+	unsigned int rejected = 0;
+	const char* traceFile = NULL;
+	const char* manifest = NULL;
+	const char* quantumCache = QUANTUM_CACHE;
+	vector<TaskData> tasks;
+	TestOptions options;
+
+	options.simulate = false;
+	options.partitioned = false;
+	options.global = false;
+	options.analyze = false;
+	options.topOnly = false;
+	options.tableKBytes = 0;
+	options.numCpus = 0;
+	options.heuristic = PACKING_FIRST_FIT;
+	options.statsName = NULL;
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "st:p:wg:adc:b:q:ex:")) != -1)
+	{
+		switch (option)
+		{
+		case 's':
+			options.simulate = true;
+			break;
+		case 't':
+			traceFile = optarg;
+			break;
+		case 'p':
+			options.partitioned = true;
+			options.numCpus = atoi(optarg);
+			break;
+		case 'w':
+			options.heuristic = PACKING_WORST_FIT;
+			break;
+		case 'g':
+			options.global = true;
+			options.numCpus = atoi(optarg);
+			break;
+		case 'a':
+			options.analyze = true;
+			break;
+		case 'd':
+			options.topOnly = true;
+			break;
+		case 'c':
+			options.tableKBytes = atoi(optarg);
+			break;
+		case 'b':
+			manifest = optarg;
+			break;
+		case 'q':
+			quantumCache = optarg;
+			break;
+		case 'e':
+			PerfCounters::setEnabled(true);
+			break;
+		case 'x':
+			options.statsName = optarg;
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-s] [-t file | -b file] [-a] [-d | -c kb] [-p cpus [-w] | -g cpus] [-q file] [-e] [-x name]" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (options.partitioned && options.global)
+	{
+		cerr << "Partitioned (-p) and global (-g) scheduling are exclusive" << endl;
+		return EXIT_FAILURE;
+	}
+	if ((options.partitioned || options.global) && !options.simulate &&
+			options.numCpus > Platform::numCpus())
+	{
+		cerr << "Only " << Platform::numCpus() << " CPUs are online for a live test" << endl;
+		return EXIT_FAILURE;
+	}
+	if (options.analyze && options.global)
+	{
+		cerr << "Schedulability analysis (-a) only covers one CPU or a partitioned (-p) task set" << endl;
+		return EXIT_FAILURE;
+	}
+	if (options.topOnly && options.simulate)
+	{
+		cerr << "Top-only dispatch (-d) only applies to live tests" << endl;
+		return EXIT_FAILURE;
+	}
+	if (options.tableKBytes > 0 && (options.simulate || options.topOnly))
+	{
+		cerr << "Table-driven dispatch (-c) only applies to live tests without -d" << endl;
+		return EXIT_FAILURE;
+	}
+	if (PerfCounters::isEnabled() && options.simulate)
+	{
+		cerr << "Performance counters (-e) only apply to live tests" << endl;
+		return EXIT_FAILURE;
+	}
+	if (options.statsName != NULL && options.simulate)
+	{
+		cerr << "Live statistics (-x) only apply to live tests" << endl;
+		return EXIT_FAILURE;
+	}
+	if (PerfCounters::isEnabled() && !PerfCounters().open())
+	{
+		cerr << "Warning: performance counters are not available" << endl;
+	}
+	if (manifest != NULL && traceFile != NULL)
+	{
+		cerr << "A trace file (-t) only covers a single test, not a batch (-b)" << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Run a single test read from stdin
+	if (manifest == NULL)
+	{
+		readTest(cin, true, algorithm, testRuntime, tasks);
+
+		// Calibrate the cycle counter, spin primitive and compute quantum
+		calibrate(options, quantumCache);
+
+		result = runTest(options, algorithm, testRuntime, tasks, NULL);
+		if (result != EXIT_SUCCESS)
+		{
+			return result;
+		}
+
+		// Save the binary schedule trace if requested.
+		if (traceFile != NULL && !TraceFile::write(traceFile, (AlgorithmType)algorithm, tasks,
+				testRuntime, Platform::cyclesPerSec(), scheduleTrace))
+		{
+			cerr << "Error writing trace file " << traceFile << endl;
+			return EXIT_FAILURE;
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+	// Otherwise run every test of the manifest, streaming the results as each
+	// one completes: calibrate once and keep the task threads between tests.
+	ifstream in(manifest);
+	if (!in)
+	{
+		cerr << "Error reading manifest " << manifest << endl;
+		return EXIT_FAILURE;
+	}
+	calibrate(options, quantumCache);
+	TaskPool pool;
+	while (readTest(in, false, algorithm, testRuntime, tasks))
+	{
+		cout << "EXPERIMENT " << experiment++ << "," << algorithm << "," << testRuntime << "," <<
+				tasks.size() << endl;
+		if (runTest(options, algorithm, testRuntime, tasks, &pool) != EXIT_SUCCESS)
+		{
+			rejected++;
+		}
+		cout << flush;
+	}
+	cout << "BATCH " << experiment << "," << rejected << "," << pool.size() << endl;
 
-	delete scheduler;
 	return EXIT_SUCCESS;
 }
@@ -13,6 +13,8 @@
 
 // Standard C/C++ includes
 #include <cstdlib>
+#include <cstdio>
+#include <string>
 #include <iostream>
 #include <vector>
 #include <map>
@@ -20,19 +22,24 @@
 #include <assert.h>
 #include <inttypes.h>
 
-// Global QNX libraries
+// Global OS libraries
 #include <time.h>
-#include <sys/trace.h>
-#include <sys/siginfo.h>
-#include <sys/syspage.h>
-#include <sys/netmgr.h>
-#include <sys/neutrino.h>
+#include <sched.h>
 #include <signal.h>
 #include <errno.h>
 #include <unistd.h>
 #include <stdint.h>
 #include <semaphore.h>
 
+// QNX-only libraries (wrapped by the Platform class)
+#ifdef __QNX__
+#include <sys/trace.h>
+#include <sys/siginfo.h>
+#include <sys/syspage.h>
+#include <sys/netmgr.h>
+#include <sys/neutrino.h>
+#endif
+
 // For simplicity
 using namespace std;
 
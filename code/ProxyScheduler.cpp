@@ -9,32 +9,38 @@
 //*****************************************************************
 
 #include "ProxyScheduler.h"
+#include <algorithm>
 
-// Global semaphore that is exposed for quick (minimal overhead) access by tasks
-sem_t proxySem;
+// Global schedule trace that is exposed for quick (lock-free) access by tasks
+TraceBuffer scheduleTrace;
 
-// Global task list that is exposed for quick (minimal overhead) access by tasks
-vector<int> scheduleList;
-
-/**
- * External (but friendly) function that is used as a callback
- * for the schedule test timer. The single parameter stores
- * a pointer to the respective ProxyScheduler object whose period has
- * just expired.
- *
- * @param arg - sigval struct containing a pointer to a ProxyScheduler object
- */
-void testTimerExpired(sigval arg);
+// Static member definitions
+pthread_mutex_t ProxyScheduler::logLock = PTHREAD_MUTEX_INITIALIZER;
+const int ProxyScheduler::NO_PRIORITY;
 
 /**
  * Default constructor for the proxy scheduler, which
  * takes in a list of tasks and begins execution.
  *
  * @param taskSet - the collection of pointers to task objects.
+ * @param taskIDs - the (global) ID of each task, if the task set is one
+ *                  partition of a larger set (defaults to 0 to n-1)
+ * @param slots - the number of CPUs the tasks are globally scheduled on
+ *                (the slots highest priority tasks run at once)
  */
-ProxyScheduler::ProxyScheduler(AlgorithmType alg, vector<TaskData> taskSet, int runtime, unsigned int id)
+ProxyScheduler::ProxyScheduler(AlgorithmType alg, vector<TaskData> taskSet, int runtime, unsigned int id,
+		const vector<unsigned int>& taskIDs, unsigned int slots)
 {
 	int result;
+	pthread_mutexattr_t attributes;
+
+	// The lock on the shared scheduling state (global mode) is taken by
+	// task threads and timer dispatchers alike, so it passes the priority
+	// of a waiter on to its holder.
+	pthread_mutexattr_init(&attributes);
+	pthread_mutexattr_setprotocol(&attributes, PTHREAD_PRIO_INHERIT);
+	pthread_mutex_init(&sharedLock, &attributes);
+	pthread_mutexattr_destroy(&attributes);
 
 	// Attempt to initialize the execution semaphore.
 	result = sem_init(&proxySem, 0, SEM_COUNT);
@@ -53,9 +59,35 @@ ProxyScheduler::ProxyScheduler(AlgorithmType alg, vector<TaskData> taskSet, int
 		this->uid = id;
 		this->realScheduleTime = 0;
 		this->numScheduleEvents = 0;
+		this->slots = (slots > 0) ? slots : 1;
+		this->global = false;
+		this->sharedPolicy = NULL;
+		this->dispatchTopOnly = false;
+		this->tableBudget = 0;
+		this->pool = NULL;
+		this->statsExport = NULL;
+		this->statsIndex = 0;
+
+		// Number the tasks 0 to n-1 unless they belong to a larger set.
+		this->taskIDs = taskIDs;
+		if (this->taskIDs.empty())
+		{
+			for (unsigned int i = 0; i < taskSet.size(); i++)
+			{
+				this->taskIDs.push_back(i);
+			}
+		}
+		for (vector<unsigned int>::iterator itr = this->taskIDs.begin(); itr != this->taskIDs.end(); itr++)
+		{
+			if (*itr >= members.size())
+			{
+				members.resize(*itr + 1, false);
+			}
+			members[*itr] = true;
+		}
 
-		// Configure the runtime timer.
-		configureTimer();
+		// Size the task event queue for a few pending events per task.
+		taskEvents.reset((taskSet.size() * TASK_EVENTS_PER_TASK) + 1);
 	}
 }
 
@@ -65,11 +97,13 @@ ProxyScheduler::ProxyScheduler(AlgorithmType alg, vector<TaskData> taskSet, int
  */
 ProxyScheduler::~ProxyScheduler()
 {
-	// Traverse task list and destroy all instances.
-	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	// Traverse task list and destroy all instances (unless the pool owns them).
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end() && pool == NULL; itr++)
 	{
 		delete(*itr);
 	}
+	sem_destroy(&proxySem);
+	pthread_mutex_destroy(&sharedLock);
 }
 
 /**
@@ -78,59 +112,124 @@ ProxyScheduler::~ProxyScheduler()
 void* ProxyScheduler::startRoutine()
 {	
 	// First, create the tasks and then kick them off to run
-	int taskID = 0;
+	unsigned int taskIndex = 0;
 	int pol = 0;
 	uint64_t startCycleTime;
 	uint64_t endCycleTime;
+	bool replayTable = false;
 	struct sched_param schedParam;
 
+	taskTable.reset(taskData.size());
 	for (vector<TaskData>::iterator itr = taskData.begin(); itr != taskData.end(); itr++)
 	{
-		Task* task = new Task(taskID++, (*itr).computeTime, (*itr).periodTime);
+		Task* task;
+		if (pool != NULL)
+		{
+			task = pool->acquire(taskIDs[taskIndex++], (*itr).computeTime, (*itr).periodTime, &taskTable, getCpu());
+		}
+		else
+		{
+			task = new Task(taskIDs[taskIndex++], (*itr).computeTime, (*itr).periodTime, &taskTable);
+			task->setCpu(getCpu()); // tasks share the scheduler's CPU (if any)
+		}
+		task->setProxy(this);
+		task->setStatsExport(statsExport);
+		task->prepareJobs(runtime);
 		tasks.push_back(task);
 	}
 
-	// Construct the convenience task map.
+	// Construct the convenience task table.
+	taskMap.assign(members.size(), NULL);
 	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
 	{
-		taskMap[(*itr)->taskID()] = *itr; // drop each task pointer in the map
+		taskMap[(*itr)->taskID()] = *itr; // drop each task pointer in the table
 	}
 
-	// Now construct the appropriate scheduler based on the algorithm type
-	switch (algorithmType)
+	// Validate the algorithm type before the test starts
+	if (algorithmType != ALGORITHM_TYPE_RMA && algorithmType != ALGORITHM_TYPE_EDF &&
+			algorithmType != ALGORITHM_TYPE_SCT)
 	{
-	case ALGORITHM_TYPE_RMA:
-		scheduler = new RMAlgorithm();
-		break;
-	case ALGORITHM_TYPE_EDF:
-		scheduler = new EDFAlgorithm();
-		break;
-	case ALGORITHM_TYPE_SCT:
-		scheduler = new SCTAlgorithm();
-		break;
-	default:
 		cerr << "Invalid scheduling algorithm selection. Terminating now." << endl;
 		kill();
 		return NULL;
 	}
 
-	// Now run the test and then clean up
+	// Compile the cyclic-executive table if requested (falling back to online scheduling)
+	if (tableBudget > 0)
+	{
+		replayTable = cyclicTable.compile(algorithmType, taskData, taskIDs, slots, tableBudget);
+		pthread_mutex_lock(&logLock);
+		cout << "TABLE " << replayTable << "," << cyclicTable.getHyperperiod() << "," <<
+				cyclicTable.getEntries() << "," << cyclicTable.getSize() << endl;
+		pthread_mutex_unlock(&logLock);
+	}
+
+	// Now run the test with the appropriate scheduling policy and then clean up
+	pthread_mutex_lock(&logLock);
 	cout << "START" << endl;
-	startCycleTime = ClockCycles();
-	runTest();
-	endCycleTime = ClockCycles();
+	pthread_mutex_unlock(&logLock);
+	counters.open();
+	counters.start();
+	startCycleTime = Platform::clockCycles();
+	if (dispatchTopOnly && algorithmType == ALGORITHM_TYPE_EDF)
+	{
+		runTopOnlyTest(taskTable.getDeadlines());
+	}
+	else if (dispatchTopOnly && algorithmType == ALGORITHM_TYPE_SCT)
+	{
+		runTopOnlyTest(taskTable.getRemainingTimes());
+	}
+	else if (replayTable)
+	{
+		runTest(cyclicTable);
+	}
+	else if (global)
+	{
+		runGlobalTest();
+	}
+	else if (algorithmType == ALGORITHM_TYPE_RMA)
+	{
+		RMAlgorithm policy;
+		runTest(policy);
+	}
+	else if (algorithmType == ALGORITHM_TYPE_EDF)
+	{
+		EDFAlgorithm policy;
+		runTest(policy);
+	}
+	else
+	{
+		SCTAlgorithm policy;
+		runTest(policy);
+	}
+	endCycleTime = Platform::clockCycles();
 	realRuntime = (endCycleTime - startCycleTime);
-	cout << "STOP" << endl;
-	delete scheduler;
 
-	// Log proxy scheduler data
+	// Log proxy scheduler data and all task data (in one piece)
+	pthread_mutex_lock(&logLock);
+	cout << "STOP" << endl;
 	logData();
-
-	// Log all task data and then kill each task
 	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
 	{
 		(*itr)->logData();
-		(*itr)->stopTask();
+	}
+	pthread_mutex_unlock(&logLock);
+
+	// Kill each task, or hand it back to the task pool for the next test
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		if (pool != NULL)
+		{
+			pool->release(*itr);
+		}
+		else
+		{
+			(*itr)->stopTask();
+		}
+	}
+	if (pool != NULL)
+	{
+		tasks.clear(); // owned by the pool
 	}
 
 	// Terminate and return
@@ -138,24 +237,49 @@ void* ProxyScheduler::startRoutine()
 }
 
 /**
- * Start the schedule test.
+ * Start the schedule test. The test loop is instantiated for each
+ * scheduling policy, so a schedule event makes no virtual calls.
+ *
+ * @param policy - the scheduling policy used to determine task priorities
  */
-void ProxyScheduler::runTest()
+template <class Policy>
+void ProxyScheduler::runTest(Policy& policy)
 {
 	timeExpired = false;
 	uint64_t startCycleTime = 0;
 	uint64_t endCycleTime = 0;
+	unsigned int changedTask = 0;
+	vector<unsigned int> previousTop;
+	vector<unsigned int> currentTop;
+	vector<PriorityMove> moves;
+
+	previousTop.reserve(slots);
+	currentTop.reserve(slots);
+	moves.reserve(tasks.size());
+
+	// Nothing has been assigned yet, so every task's first priority is a change.
+	appliedPriorities.assign(members.size(), NO_PRIORITY);
+
+	// Size every scheduling list for the task set now, so no schedule event allocates
+	policy.reserve(tasks.size(), members.size());
 
-	// Determine the initial task schedules
-	vector<unsigned int> priorities = scheduler->scheduleTasks(tasks);
+	// Determine the initial task schedules (every task starts out released)
+	policy.resetOrder(taskTable, moves);
+	const vector<unsigned int>& priorities = policy.getOrder();
+	ranks.assign(members.size(), 0);
+	ready.reset(tasks.size());
+	applyMoves(moves);
 
-	// Start the timer to run in the background while the test is performed
-	startTimer();
+	// Create every timer (disarmed) and start the dispatcher that services them
+	configureTimers();
 
-	// Start each task
+	// Start each task (a pooled task's thread is already running)
 	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
 	{
-		(*itr)->start();
+		if (!(*itr)->isAlive())
+		{
+			(*itr)->start();
+		}
 	}
 
 	// Allow each timer to start
@@ -166,8 +290,10 @@ void ProxyScheduler::runTest()
 		sem_wait(&proxySem);
 	}
 
-	// Finally, assign priorities and start each task
-	setTaskPriorities(priorities);
+	// Finally, assign priorities, start the timers and start each task
+	setTaskPriorities(moves);
+	startJobs();
+	armTimers();
 	releaseTasks(priorities); // this release starts the tests
 
 	// Run the test until the time expires
@@ -175,25 +301,310 @@ void ProxyScheduler::runTest()
 	{
 		// Blocks on scheduling semaphore
 		sem_wait(&proxySem);
-		startCycleTime = ClockCycles();
+		startCycleTime = Platform::clockCycles();
+
+		// Remember which tasks were running before the order changes
+		topTasks(priorities, previousTop);
+
+		// Only re-rank the task whose period expired, unless the event
+		// queue lost track of which task that was.
+		if (nextTaskEvent(&changedTask))
+		{
+			policy.taskChanged(taskTable, changedTask, moves);
+			setTaskPriorities(moves);
+			applyMoves(moves);
+			ready.set(ranks[changedTask]);
+			taskMap[changedTask]->release();
+		}
+		else
+		{
+			policy.resetOrder(taskTable, moves);
+			setTaskPriorities(moves);
+			applyMoves(moves);
+			releaseTasks(priorities);
+		}
+
+		// Preempt a running task only if it was displaced from the running
+		// slots; it blocks and is released again so it resumes at its new priority.
+		topTasks(priorities, currentTop);
+		for (vector<unsigned int>::iterator itr = previousTop.begin(); itr != previousTop.end(); itr++)
+		{
+			if (find(currentTop.begin(), currentTop.end(), *itr) == currentTop.end())
+			{
+				taskMap[*itr]->pause();
+				taskMap[*itr]->release();
+			}
+		}
 
-		// Pause all tasks
-		for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+		// Record the time for this schedule event
+		endCycleTime = Platform::clockCycles();
+		realScheduleTime += (endCycleTime - startCycleTime);
+		numScheduleEvents++;
+		scheduleLatency.record(endCycleTime - startCycleTime);
+		if (statsExport != NULL)
 		{
-			(*itr)->pause();
+			statsExport->publishScheduler(statsIndex, numScheduleEvents, realScheduleTime);
 		}
+	}
+
+	// Kill all tasks
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		(*itr)->stopTest();
+	}
+
+	// Stop the timers - no longer needed
+	stopTimers();
+}
+
+/**
+ * Start the schedule test in global mode, where the proxy scheduler
+ * thread only starts and stops the test (see setGlobal()).
+ */
+void ProxyScheduler::runGlobalTest()
+{
+	timeExpired = false;
+	sharedPreviousTop.reserve(slots);
+	sharedCurrentTop.reserve(slots);
+	sharedMoves.reserve(tasks.size());
 
-		// Re-determine the new priorities
-		priorities = scheduler->scheduleTasks(tasks);
+	// Nothing has been assigned yet, so every task's first priority is a change.
+	appliedPriorities.assign(members.size(), NO_PRIORITY);
 
-		// Assign the priorities and then release all tasks again
-		setTaskPriorities(priorities);
-		releaseTasks(priorities);
+	// Build the shared priority list (sized now, so no schedule event
+	// allocates) and the ready bitmap; every task starts out released
+	SchedulingAlgorithm* policy = SchedulingAlgorithm::create(algorithmType);
+	policy->reserve(tasks.size(), members.size());
+	policy->resetOrder(taskTable, sharedMoves);
+	const vector<unsigned int>& priorities = policy->getOrder();
+	ranks.assign(members.size(), 0);
+	ready.reset(tasks.size());
+	applyMoves(sharedMoves);
+
+	// Create every timer (disarmed) and start the dispatchers that service them
+	configureTimers();
+
+	// Start each task (a pooled task's thread is already running)
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		if (!(*itr)->isAlive())
+		{
+			(*itr)->start();
+		}
+	}
+
+	// Allow each timer to start
+	releaseTasks(priorities);
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		sched_yield();
+		sem_wait(&proxySem);
+	}
+
+	// Finally, assign priorities, hand the shared state over to the event
+	// paths, start the timers and start each task
+	setTaskPriorities(sharedMoves);
+	sharedPolicy = policy;
+	startJobs();
+	armTimers();
+	releaseTasks(priorities); // this release starts the tests
+
+	// Sleep until the time expires; the dispatchers do the scheduling
+	while (!timeExpired)
+	{
+		sem_wait(&proxySem);
+	}
+
+	// Kill all tasks (no event may be halfway through re-ranking them)
+	pthread_mutex_lock(&sharedLock);
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		(*itr)->stopTest();
+	}
+	pthread_mutex_unlock(&sharedLock);
+
+	// Stop the timers - no longer needed
+	stopTimers();
+	pthread_mutex_lock(&sharedLock);
+	sharedPolicy = NULL;
+	pthread_mutex_unlock(&sharedLock);
+	delete policy;
+}
+
+/**
+ * Re-rank a task whose period expired in the shared priority list and
+ * preempt the tasks it displaced from the running slots (global mode,
+ * called on the CPU whose timer dispatcher serviced the event).
+ *
+ * @param id - the ID of the task whose period expired
+ */
+void ProxyScheduler::scheduleGlobalEvent(unsigned int id)
+{
+	uint64_t startCycleTime = Platform::clockCycles();
+	uint64_t endCycleTime = 0;
+
+	pthread_mutex_lock(&sharedLock);
+	if (timeExpired || sharedPolicy == NULL)
+	{
+		pthread_mutex_unlock(&sharedLock);
+		return;
+	}
+	const vector<unsigned int>& priorities = sharedPolicy->getOrder();
+
+	// Remember which tasks were running, re-rank the task and release it
+	topTasks(priorities, sharedPreviousTop);
+	sharedPolicy->taskChanged(taskTable, id, sharedMoves);
+	setTaskPriorities(sharedMoves);
+	applyMoves(sharedMoves);
+	ready.set(ranks[id]);
+	taskMap[id]->release();
+
+	// Preempt a running task only if it was displaced from the running
+	// slots; it blocks and is released again so it resumes at its new priority.
+	topTasks(priorities, sharedCurrentTop);
+	for (vector<unsigned int>::iterator itr = sharedPreviousTop.begin(); itr != sharedPreviousTop.end(); itr++)
+	{
+		if (find(sharedCurrentTop.begin(), sharedCurrentTop.end(), *itr) == sharedCurrentTop.end())
+		{
+			taskMap[*itr]->pause();
+			taskMap[*itr]->release();
+		}
+	}
+
+	// Record the time for this schedule event
+	endCycleTime = Platform::clockCycles();
+	realScheduleTime += (endCycleTime - startCycleTime);
+	numScheduleEvents++;
+	scheduleLatency.record(endCycleTime - startCycleTime);
+	if (statsExport != NULL)
+	{
+		statsExport->publishScheduler(statsIndex, numScheduleEvents, realScheduleTime);
+	}
+	pthread_mutex_unlock(&sharedLock);
+}
+
+/**
+ * Start the schedule test in dispatch-top-only mode.
+ *
+ * @param keys - the scheduling key of every slot of the task table
+ */
+void ProxyScheduler::runTopOnlyTest(const unsigned int* keys)
+{
+	timeExpired = false;
+	uint64_t startCycleTime = 0;
+	uint64_t endCycleTime = 0;
+	unsigned int changedTask = 0;
+	unsigned int lowest = tasks.size() - 1;
+	vector<unsigned int> previousTop;
+	vector<unsigned int> currentTop;
+	vector<PriorityMove> moves;
+	PriorityMove move;
+
+	previousTop.reserve(slots);
+	currentTop.reserve(slots);
+	moves.reserve(tasks.size());
+	selection.resize(slots);
+
+	// Every task starts out at the lowest priority, except the top tasks.
+	appliedPriorities.assign(members.size(), NO_PRIORITY);
+	selectTopTasks(keys, currentTop);
+	for (unsigned int i = 0; i < taskIDs.size(); i++)
+	{
+		move.taskID = taskIDs[i];
+		move.rank = lowest;
+		moves.push_back(move);
+	}
+	for (unsigned int i = 0; i < currentTop.size(); i++)
+	{
+		move.taskID = currentTop[i];
+		move.rank = i;
+		moves.push_back(move);
+	}
+
+	// Create every timer (disarmed) and start the dispatcher that services them
+	configureTimers();
+
+	// Start each task (a pooled task's thread is already running)
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		if (!(*itr)->isAlive())
+		{
+			(*itr)->start();
+		}
+	}
+
+	// Allow each timer to start
+	releaseTasks(taskIDs);
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		sched_yield();
+		sem_wait(&proxySem);
+	}
+
+	// Finally, assign priorities, start the timers and start each task
+	setTaskPriorities(moves);
+	startJobs();
+	armTimers();
+	releaseTasks(taskIDs); // this release starts the tests
+
+	// Run the test until the time expires
+	while (!timeExpired)
+	{
+		// Blocks on scheduling semaphore
+		sem_wait(&proxySem);
+		startCycleTime = Platform::clockCycles();
+
+		// Release the task whose period expired or that completed a compute
+		// cycle (or every task if the event queue lost track of which task
+		// that was).
+		if (nextTaskEvent(&changedTask))
+		{
+			taskMap[changedTask]->release();
+		}
+		else
+		{
+			releaseTasks(taskIDs);
+		}
+
+		// Select the new top tasks, drop the displaced ones to the lowest
+		// priority and preempt them so they resume at it.
+		previousTop.swap(currentTop);
+		selectTopTasks(keys, currentTop);
+		moves.clear();
+		for (unsigned int i = 0; i < currentTop.size(); i++)
+		{
+			move.taskID = currentTop[i];
+			move.rank = i;
+			moves.push_back(move);
+		}
+		for (vector<unsigned int>::iterator itr = previousTop.begin(); itr != previousTop.end(); itr++)
+		{
+			if (find(currentTop.begin(), currentTop.end(), *itr) == currentTop.end())
+			{
+				move.taskID = *itr;
+				move.rank = lowest;
+				moves.push_back(move);
+			}
+		}
+		setTaskPriorities(moves);
+		for (vector<unsigned int>::iterator itr = previousTop.begin(); itr != previousTop.end(); itr++)
+		{
+			if (find(currentTop.begin(), currentTop.end(), *itr) == currentTop.end())
+			{
+				taskMap[*itr]->pause();
+				taskMap[*itr]->release();
+			}
+		}
 
 		// Record the time for this schedule event
-		endCycleTime = ClockCycles();
+		endCycleTime = Platform::clockCycles();
 		realScheduleTime += (endCycleTime - startCycleTime);
 		numScheduleEvents++;
+		scheduleLatency.record(endCycleTime - startCycleTime);
+		if (statsExport != NULL)
+		{
+			statsExport->publishScheduler(statsIndex, numScheduleEvents, realScheduleTime);
+		}
 	}
 
 	// Kill all tasks
@@ -202,8 +613,27 @@ void ProxyScheduler::runTest()
 		(*itr)->stopTest();
 	}
 
-	// Delete the timer - no longer needed
-	timer_delete(timerID);
+	// Stop the timers - no longer needed
+	stopTimers();
+}
+
+/**
+ * Select the highest priority pending tasks (at most one per slot).
+ *
+ * @param keys - the scheduling key of every slot of the task table
+ * @param top - set to the IDs of the selected tasks, highest priority first
+ */
+void ProxyScheduler::selectTopTasks(const unsigned int* keys, vector<unsigned int>& top)
+{
+	unsigned int count;
+
+	count = TaskSelect::selectTop(keys, taskTable.getTaskIDs(), taskTable.getBacklogs(),
+			taskTable.size(), slots, &selection[0]);
+	top.clear();
+	for (unsigned int i = 0; i < count; i++)
+	{
+		top.push_back(taskTable.getTaskID(selection[i]));
+	}
 }
 
 /**
@@ -215,51 +645,117 @@ void ProxyScheduler::logData()
 	float realSchedTime = 0;
 	float realTime = 0;
 	char data[256]; // arbitrary size big enough to fit what we need
-	char stringHolder[4];
 	string trace;
 
 	// Determine the clock rate
-	cps = SYSPAGE_ENTRY(qtime)->cycles_per_sec;
+	cps = Platform::cyclesPerSec();
 
 	// Calculate the real compute time period
 	realTime = ((float)((float)realRuntime / (float)cps));
 	realSchedTime = ((float)((float)realScheduleTime / (float)cps));
 
-	// Log the schedule trace
-	for (vector<int>::iterator itr = scheduleList.begin(); itr != scheduleList.end(); itr++)
+	// Log the schedule trace (of this scheduler's tasks only)
+	scheduleTrace.formatSchedule(trace, members);
+	Platform::traceString(EVENT_SCHEDULE_TRACE, trace.c_str());
+	cout << "TRACE " << trace.c_str() << endl;
+	if (scheduleTrace.droppedRecords() > 0)
 	{
-		trace.append(itoa(*itr, stringHolder, 10));
-		trace.append(",");
+		cerr << "Warning: " << scheduleTrace.droppedRecords() << " trace records dropped" << endl;
 	}
-	TraceEvent(_NTO_TRACE_INSERTUSRSTREVENT, EVENT_SCHEDULE_TRACE, trace.c_str());
-	cout << "TRACE " << trace.c_str() << endl;
 
 	// Log the data
 	sprintf(data, "PDATA %f,%f,%f", realSchedTime / numScheduleEvents, realTime, (float)(realTime - runtime) / (realTime));
-	TraceEvent(_NTO_TRACE_INSERTUSRSTREVENT, EVENT_PROXY_DATA, data);
+	counters.format(data, sizeof(data));
+	Platform::traceString(EVENT_PROXY_DATA, data);
+	cout << data << endl;
+
+	// Log the latency distributions (count,p50,p99,p99.9,max in us)
+	LatencyHistogram releaseLatency;
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		releaseLatency.add((*itr)->getReleaseLatency());
+	}
+	scheduleLatency.format(data, sizeof(data), "PHIST schedule", cps);
+	Platform::traceString(EVENT_PROXY_DATA, data);
+	cout << data << endl;
+	releaseLatency.format(data, sizeof(data), "PHIST release", cps);
+	Platform::traceString(EVENT_PROXY_DATA, data);
 	cout << data << endl;
 }
 
 /**
- * Set the priority of each task from the context of the proxy scheduler thread.
+ * Set the priority of each moved task from the context of the proxy scheduler thread.
  *
- * @param priorities - the descending list of priorities used
- *                     to assign dynamic priorities.
+ * @param moves - the new ranks (0 is the highest priority) of the tasks
+ *                that moved in the descending priority list.
  */
-void ProxyScheduler::setTaskPriorities(vector<unsigned int> priorities)
+void ProxyScheduler::setTaskPriorities(const vector<PriorityMove>& moves)
 {
 	struct sched_param* schedParam;
 
 	// Assign priorities in descending order in order to let the QNX scheduler
 	// manage the scheduling with as little overhead as possible.
-	int val = 0;
-	int pol;
-	for (vector<unsigned int>::reverse_iterator itr = priorities.rbegin(); itr != priorities.rend(); itr++)
+	int highest = priority + tasks.size() - 1;
+	int newPriority;
+	for (vector<PriorityMove>::const_iterator itr = moves.begin(); itr != moves.end(); itr++)
+	{
+		// Skip the system call if the task already has this priority.
+		newPriority = highest - (*itr).rank;
+		if (appliedPriorities[(*itr).taskID] == newPriority)
+		{
+			continue;
+		}
+		appliedPriorities[(*itr).taskID] = newPriority;
+
+		schedParam = taskMap[(*itr).taskID]->getSchedParam();
+		schedParam->sched_priority = newPriority;
+		Platform::setPriority(taskMap[(*itr).taskID]->threadID(), schedParam);
+	}
+}
+
+/**
+ * Apply the priority moves reported by the scheduling policy to the
+ * rank index and the ready bitmap.
+ *
+ * @param moves - the new ranks of the tasks that moved
+ */
+void ProxyScheduler::applyMoves(const vector<PriorityMove>& moves)
+{
+	// Every rank a task left is reported as the new rank of another task
+	for (vector<PriorityMove>::const_iterator itr = moves.begin(); itr != moves.end(); itr++)
+	{
+		ranks[itr->taskID] = itr->rank;
+		ready.assign(itr->rank, taskMap[itr->taskID]->pendingWork());
+	}
+}
+
+/**
+ * Find the highest priority tasks that have a compute cycle pending
+ * (i.e. the tasks that the OS is running, one per slot) straight from
+ * the ready bitmap, clearing the bits of the tasks that completed
+ * their compute cycle since they were set.
+ *
+ * @param priorities - the descending list of task IDs
+ * @param running - set to the IDs of (at most slots) running tasks
+ */
+void ProxyScheduler::topTasks(const vector<unsigned int>& priorities, vector<unsigned int>& running)
+{
+	unsigned int level;
+
+	// Tasks only complete on their own threads, so a completion is
+	// noticed (and its bit cleared) here, once per compute cycle.
+	running.clear();
+	for (level = ready.first(); level != ReadyMap::NO_LEVEL && running.size() < slots;
+			level = ready.next(level))
 	{
-		schedParam = taskMap[*itr]->getSchedParam();
-		schedParam->sched_priority = priority + val++;
-		pthread_setschedparam(taskMap[*itr]->threadID(), SCHED_RR, schedParam);
-		pthread_getschedparam(taskMap[*itr]->threadID(), &pol, schedParam);
+		if (taskMap[priorities[level]]->pendingWork())
+		{
+			running.push_back(priorities[level]);
+		}
+		else
+		{
+			ready.clear(level);
+		}
 	}
 }
 
@@ -268,9 +764,9 @@ void ProxyScheduler::setTaskPriorities(vector<unsigned int> priorities)
  *
  * @param priorities - list of priorities used to determine the order of release.
  */
-void ProxyScheduler::releaseTasks(vector<unsigned int> priorities)
+void ProxyScheduler::releaseTasks(const vector<unsigned int>& priorities)
 {
-	for (vector<unsigned int>::iterator itr = priorities.begin(); itr != priorities.end(); itr++)
+	for (vector<unsigned int>::const_iterator itr = priorities.begin(); itr != priorities.end(); itr++)
 	{
 		taskMap[*itr]->release();
 	}
@@ -288,27 +784,83 @@ void ProxyScheduler::pauseTasks()
 }
 
 /**
- * Configure the timer for the schedule test duration.
+ * Record the start of the test (the release of every task's first job)
+ * right before the period timers are armed.
+ */
+void ProxyScheduler::startJobs()
+{
+	uint64_t startCycleTime = Platform::clockCycles();
+
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		(*itr)->startJobs(startCycleTime);
+	}
+}
+
+/**
+ * Register the test duration timer and every task's period timer
+ * with the timer dispatcher and start the dispatcher thread.
+ */
+void ProxyScheduler::configureTimers()
+{
+	int pol;
+	struct sched_param schedParam;
+	unsigned int count = global ? slots : 1;
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		dispatchers.push_back(new TimerDispatcher());
+	}
+
+	// One-shot timer for the test duration
+	dispatchers[0]->addTimer(runtime * NS_PER_SEC, 0, &testTimerExpired, this);
+
+	// Periodic timer for each task (first expiry one period after the start),
+	// dealt out across the dispatchers
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		uint64_t period = (uint64_t)tasks[i]->getPeriodTime() * NS_PER_MS;
+		dispatchers[i % count]->addTimer(period, period, &taskTimerExpired, tasks[i]);
+	}
+
+	// Run each dispatcher just above the proxy scheduler (on its CPU, or on
+	// a CPU of its own in global mode) so releases are never delayed.
+	// (The priority is set by the dispatcher thread itself before it runs,
+	// so the spinning real-time tasks can never starve it.)
+	pthread_getschedparam(pthread_self(), &pol, &schedParam);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		dispatchers[i]->setCpu(global ? (int)i : getCpu());
+		dispatchers[i]->setStartPriority(schedParam.sched_priority + 1);
+		dispatchers[i]->start();
+	}
+}
+
+/**
+ * Arm the timers of every dispatcher relative to the same instant.
  */
-void ProxyScheduler::configureTimer()
+void ProxyScheduler::armTimers()
 {
-	// Initialize the daemon timer thread to invoke a function when it expires
-	SIGEV_THREAD_INIT(&event, &testTimerExpired, this, 0);
-
-	// Configure the timer parameters (period signals only)
-	timerSpec.it_value.tv_sec = runtime;
-	timerSpec.it_value.tv_nsec = 0;
-	timerSpec.it_interval.tv_sec = runtime;
-	timerSpec.it_interval.tv_nsec = 0;
+	uint64_t base = TimerDispatcher::currentTime();
+
+	for (vector<TimerDispatcher*>::iterator itr = dispatchers.begin(); itr != dispatchers.end(); itr++)
+	{
+		(*itr)->arm(base);
+	}
 }
 
 /**
- * Start the timer for the schedule test duration.
+ * Stop and destroy every timer dispatcher.
  */
-void ProxyScheduler::startTimer()
+void ProxyScheduler::stopTimers()
 {
-	timer_create(CLOCK_REALTIME, &event, &timerID);
-	timer_settime(timerID, 0, &timerSpec, NULL);
+	for (vector<TimerDispatcher*>::iterator itr = dispatchers.begin(); itr != dispatchers.end(); itr++)
+	{
+		(*itr)->stop();
+		(*itr)->join();
+		delete(*itr);
+	}
+	dispatchers.clear();
 }
 
 /**
@@ -320,6 +872,84 @@ void ProxyScheduler::testComplete()
 	sem_post(&proxySem);
 }
 
+/**
+ * Retrieve the number of schedule events handled during the test.
+ *
+ * @return schedule event count
+ */
+uint64_t ProxyScheduler::getScheduleEvents()
+{
+	return numScheduleEvents;
+}
+
+/**
+ * Notify the proxy scheduler that a task's period expired (and hence its
+ * scheduling key changed) and wake the proxy scheduler up.
+ *
+ * @param id - the ID of the task whose period expired
+ */
+void ProxyScheduler::postTaskEvent(unsigned int id)
+{
+	// A global test is rescheduled right here, on the event's CPU.
+	if (sharedPolicy != NULL)
+	{
+		scheduleGlobalEvent(id);
+		return;
+	}
+
+	// If the queue is full the proxy will fall back to a full reschedule.
+	taskEvents.push(id);
+	sem_post(&proxySem);
+}
+
+/**
+ * Notify the proxy scheduler that a task completed a compute cycle. In
+ * dispatch-top-only mode this wakes the proxy scheduler up to select the
+ * new top tasks, and in a global test it drops the task from the ready
+ * bitmap (in the other modes every task is ranked, so the OS already runs
+ * the next one).
+ *
+ * @param id - the ID of the task that completed a compute cycle
+ */
+void ProxyScheduler::postTaskCompletion(unsigned int id)
+{
+	if (dispatchTopOnly)
+	{
+		postTaskEvent(id);
+	}
+	else if (sharedPolicy != NULL)
+	{
+		// A global test takes the task off the ready bitmap right away (on
+		// the task's own CPU) unless another compute cycle is pending.
+		pthread_mutex_lock(&sharedLock);
+		if (!timeExpired && !taskMap[id]->pendingWork())
+		{
+			ready.clear(ranks[id]);
+		}
+		pthread_mutex_unlock(&sharedLock);
+	}
+}
+
+/**
+ * Notify the proxy scheduler that a task is ready for the test to start.
+ */
+void ProxyScheduler::taskReady()
+{
+	sem_post(&proxySem);
+}
+
+/**
+ * Retrieve the next task whose period expired.
+ *
+ * @param id - set to the ID of the task whose period expired
+ * @return false if no event is pending or events were lost (in which
+ *         case every task must be rescheduled)
+ */
+bool ProxyScheduler::nextTaskEvent(unsigned int* id)
+{
+	return taskEvents.pop(id);
+}
+
 /**
  * Set the scheduler's priority.
  */
@@ -329,15 +959,84 @@ void ProxyScheduler::setPriority(int priority)
 }
 
 /**
- * External (but friendly) function that is used as a callback
+ * Only rank the highest priority pending tasks (one per slot) on each
+ * schedule event, selecting them straight from the task table instead
+ * of keeping every task ordered; the other tasks share the lowest
+ * priority. A task that completes a compute cycle is a schedule event
+ * too, so the next top task is selected as soon as a slot frees up.
+ * Only EDF and SCT (whose keys change) support this mode.
+ *
+ * @param topOnly - true to dispatch only the top tasks
+ */
+void ProxyScheduler::setDispatchTopOnly(bool topOnly)
+{
+	this->dispatchTopOnly = topOnly;
+}
+
+/**
+ * Schedule the tasks globally on the slots CPUs without a central
+ * scheduling loop: each CPU runs its own timer dispatcher, and every
+ * period event and compute cycle completion updates the shared priority
+ * list and ready bitmap (under one lock) on the CPU it happened on.
+ * Online RMA, EDF and SCT only; top-only dispatch and table replay
+ * still go through the proxy scheduler thread.
+ *
+ * @param global - true to schedule the tasks globally
+ */
+void ProxyScheduler::setGlobal(bool global)
+{
+	this->global = global;
+}
+
+/**
+ * Replay a cyclic-executive table of the scheduling algorithm (compiled
+ * offline over one hyperperiod when the test starts) instead of running
+ * the algorithm on each schedule event. If the table does not fit the
+ * budget, or the schedule does not repeat every hyperperiod, the test
+ * falls back to online scheduling.
+ *
+ * @param budget - the maximum table size in bytes (0 to schedule online)
+ */
+void ProxyScheduler::setTableBudget(uint64_t budget)
+{
+	this->tableBudget = budget;
+}
+
+/**
+ * Take the tasks from a pool of task threads (and hand them back when the
+ * test ends) instead of creating and destroying a thread per task (must be
+ * called before start()).
+ *
+ * @param pool - the task pool, or NULL to create the tasks
+ */
+void ProxyScheduler::setTaskPool(TaskPool* pool)
+{
+	this->pool = pool;
+}
+
+/**
+ * Publish the live statistics of the proxy scheduler and its tasks in a
+ * shared-memory region while the test runs (must be called before start()).
+ *
+ * @param stats - the region, or NULL to publish nothing
+ * @param index - the proxy scheduler's record in the region
+ */
+void ProxyScheduler::setStatsExport(StatsExport* stats, unsigned int index)
+{
+	this->statsExport = stats;
+	this->statsIndex = index;
+}
+
+/**
+ * External (but friendly) function that is used as the callback
  * for the schedule test timer. The single parameter stores
- * a pointer to the respective ProxyScheduler object whose period has
- * just expired.
+ * a pointer to the respective ProxyScheduler object whose test
+ * duration has just expired.
  *
- * @param arg - sigval struct containing a pointer to a ProxyScheduler object
+ * @param arg - pointer to a ProxyScheduler object
  */
-void testTimerExpired(sigval arg)
+void testTimerExpired(void* arg)
 {
-	ProxyScheduler* scheduler = (ProxyScheduler*)arg.sival_ptr;
+	ProxyScheduler* scheduler = (ProxyScheduler*)arg;
 	scheduler->testComplete();
 }
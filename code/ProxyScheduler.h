@@ -14,20 +14,38 @@
 // Module includes
 #include "Thread.h"
 #include "Project1.h"
+#include "Platform.h"
 #include "Task.h"
 #include "RMAlgorithm.h"
 #include "SCTAlgorithm.h"
 #include "EDFAlgorithm.h"
 #include "SchedulingAlgorithm.h"
+#include "TimerDispatcher.h"
+#include "TraceBuffer.h"
+#include "LatencyHistogram.h"
+#include "TaskEventQueue.h"
+#include "TaskSelect.h"
+#include "ReadyMap.h"
+#include "CyclicTable.h"
+#include "TaskPool.h"
+#include "PerfCounters.h"
+#include "StatsExport.h"
 
 // Forward declaration due to bidirection association
 class Task;
 
-// Global semaphore that is exposed for quick (minimal overhead) access by tasks
-extern sem_t proxySem;
+/**
+ * External (but friendly) function that is used as the callback
+ * for the schedule test timer. The single parameter stores
+ * a pointer to the respective ProxyScheduler object whose test
+ * duration has just expired.
+ *
+ * @param arg - pointer to a ProxyScheduler object
+ */
+void testTimerExpired(void* arg);
 
-// Global task list that is exposed for quick (minimal overhead) access by tasks
-extern vector<int> scheduleList;
+// Global schedule trace that is exposed for quick (lock-free) access by tasks
+extern TraceBuffer scheduleTrace;
 
 /**
  * This class is responsible for acting as a proxy to the main QNX scheduler
@@ -43,8 +61,13 @@ public:
 	 * takes in a list of tasks and begins execution.
 	 *
 	 * @param taskSet - the collection of pointers to task objects.
+	 * @param taskIDs - the (global) ID of each task, if the task set is one
+	 *                  partition of a larger set (defaults to 0 to n-1)
+	 * @param slots - the number of CPUs the tasks are globally scheduled on
+	 *                (the slots highest priority tasks run at once)
 	 */
-	ProxyScheduler(AlgorithmType alg, vector<TaskData> taskSet, int runtime, unsigned int id);
+	ProxyScheduler(AlgorithmType alg, vector<TaskData> taskSet, int runtime, unsigned int id,
+			const vector<unsigned int>& taskIDs = vector<unsigned int>(), unsigned int slots = 1);
 
 	/**
 	 * Default destructor that traverses the list of tasks and
@@ -53,24 +76,98 @@ public:
 	virtual ~ProxyScheduler();
 
 	/**
-	 * Configure the timer for the schedule test duration.
+	 * Signal a test completion event.
 	 */
-	void configureTimer();
+	void testComplete();
 
 	/**
-	 * Start the timer for the schedule test duration.
+	 * Retrieve the number of schedule events handled during the test.
+	 *
+	 * @return schedule event count
 	 */
-	void startTimer();
+	uint64_t getScheduleEvents();
 
 	/**
-	 * Signal a test completion event.
+	 * Set the scheduler's priority.
 	 */
-	void testComplete();
+	void setPriority(int priority);
 
 	/**
-	 * Set the scheduler's priority.
+	 * Only rank the highest priority pending tasks (one per slot) on each
+	 * schedule event, selecting them straight from the task table instead
+	 * of keeping every task ordered; the other tasks share the lowest
+	 * priority. A task that completes a compute cycle is a schedule event
+	 * too, so the next top task is selected as soon as a slot frees up.
+	 * Only EDF and SCT (whose keys change) support this mode.
+	 *
+	 * @param topOnly - true to dispatch only the top tasks
 	 */
-	void setPriority(int priority);
+	void setDispatchTopOnly(bool topOnly);
+
+	/**
+	 * Schedule the tasks globally on the slots CPUs without a central
+	 * scheduling loop: each CPU runs its own timer dispatcher, and every
+	 * period event and compute cycle completion updates the shared priority
+	 * list and ready bitmap (under one lock) on the CPU it happened on.
+	 * Online RMA, EDF and SCT only; top-only dispatch and table replay
+	 * still go through the proxy scheduler thread.
+	 *
+	 * @param global - true to schedule the tasks globally
+	 */
+	void setGlobal(bool global);
+
+	/**
+	 * Replay a cyclic-executive table of the scheduling algorithm (compiled
+	 * offline over one hyperperiod when the test starts) instead of running
+	 * the algorithm on each schedule event. If the table does not fit the
+	 * budget, or the schedule does not repeat every hyperperiod, the test
+	 * falls back to online scheduling.
+	 *
+	 * @param budget - the maximum table size in bytes (0 to schedule online)
+	 */
+	void setTableBudget(uint64_t budget);
+
+	/**
+	 * Take the tasks from a pool of task threads (and hand them back when the
+	 * test ends) instead of creating and destroying a thread per task (must be
+	 * called before start()).
+	 *
+	 * @param pool - the task pool, or NULL to create the tasks
+	 */
+	void setTaskPool(TaskPool* pool);
+
+	/**
+	 * Publish the live statistics of the proxy scheduler and its tasks in a
+	 * shared-memory region while the test runs (must be called before start()).
+	 *
+	 * @param stats - the region, or NULL to publish nothing
+	 * @param index - the proxy scheduler's record in the region
+	 */
+	void setStatsExport(StatsExport* stats, unsigned int index);
+
+	/**
+	 * Notify the proxy scheduler that a task's period expired (and hence its
+	 * scheduling key changed) and wake the proxy scheduler up.
+	 *
+	 * @param id - the ID of the task whose period expired
+	 */
+	void postTaskEvent(unsigned int id);
+
+	/**
+	 * Notify the proxy scheduler that a task completed a compute cycle. In
+	 * dispatch-top-only mode this wakes the proxy scheduler up to select the
+	 * new top tasks, and in a global test it drops the task from the ready
+	 * bitmap (in the other modes every task is ranked, so the OS already runs
+	 * the next one).
+	 *
+	 * @param id - the ID of the task that completed a compute cycle
+	 */
+	void postTaskCompletion(unsigned int id);
+
+	/**
+	 * Notify the proxy scheduler that a task is ready for the test to start.
+	 */
+	void taskReady();
 
 protected:
 	/**
@@ -86,19 +183,38 @@ private:
 	void logData();
 
 	/**
-	 * Set the priority of each task from the context of the proxy scheduler thread.
+	 * Set the priority of each moved task from the context of the proxy scheduler thread.
+	 *
+	 * @param moves - the new ranks (0 is the highest priority) of the tasks
+	 *                that moved in the descending priority list.
+	 */
+	void setTaskPriorities(const vector<PriorityMove>& moves);
+
+	/**
+	 * Apply the priority moves reported by the scheduling policy to the
+	 * rank index and the ready bitmap.
+	 *
+	 * @param moves - the new ranks of the tasks that moved
+	 */
+	void applyMoves(const vector<PriorityMove>& moves);
+
+	/**
+	 * Find the highest priority tasks that have a compute cycle pending
+	 * (i.e. the tasks that the OS is running, one per slot) straight from
+	 * the ready bitmap, clearing the bits of the tasks that completed
+	 * their compute cycle since they were set.
 	 *
-	 * @param priorities - the descending list of priorities used
-	 *                     to assign dynamic priorities.
+	 * @param priorities - the descending list of task IDs
+	 * @param running - set to the IDs of (at most slots) running tasks
 	 */
-	void setTaskPriorities(vector<unsigned int> priorities);
+	void topTasks(const vector<unsigned int>& priorities, vector<unsigned int>& running);
 
 	/**
 	 * Release all tasks from their blocked state.
 	 *
 	 * @param priorities - list of priorities used to determine the order of release.
 	 */
-	void releaseTasks(vector<unsigned int> priorities);
+	void releaseTasks(const vector<unsigned int>& priorities);
 
 	/**
 	 * Preempt all running tasks and put them in their blocked state.
@@ -106,16 +222,79 @@ private:
 	void pauseTasks();
 
 	/**
-	 * Start the schedule test.
+	 * Start the schedule test. The test loop is instantiated for each
+	 * scheduling policy, so a schedule event makes no virtual calls.
+	 *
+	 * @param policy - the scheduling policy used to determine task priorities
+	 */
+	template <class Policy>
+	void runTest(Policy& policy);
+
+	/**
+	 * Start the schedule test in global mode, where the proxy scheduler
+	 * thread only starts and stops the test (see setGlobal()).
+	 */
+	void runGlobalTest();
+
+	/**
+	 * Re-rank a task whose period expired in the shared priority list and
+	 * preempt the tasks it displaced from the running slots (global mode,
+	 * called on the CPU whose timer dispatcher serviced the event).
+	 *
+	 * @param id - the ID of the task whose period expired
+	 */
+	void scheduleGlobalEvent(unsigned int id);
+
+	/**
+	 * Start the schedule test in dispatch-top-only mode.
+	 *
+	 * @param keys - the scheduling key of every slot of the task table
+	 */
+	void runTopOnlyTest(const unsigned int* keys);
+
+	/**
+	 * Select the highest priority pending tasks (at most one per slot).
+	 *
+	 * @param keys - the scheduling key of every slot of the task table
+	 * @param top - set to the IDs of the selected tasks, highest priority first
+	 */
+	void selectTopTasks(const unsigned int* keys, vector<unsigned int>& top);
+
+	/**
+	 * Retrieve the next task whose period expired.
+	 *
+	 * @param id - set to the ID of the task whose period expired
+	 * @return false if no event is pending or events were lost (in which
+	 *         case every task must be rescheduled)
+	 */
+	bool nextTaskEvent(unsigned int* id);
+
+	/**
+	 * Register the test duration timer and every task's period timer
+	 * with the timer dispatchers (one per CPU in global mode, the task
+	 * timers spread across them) and start the dispatcher threads.
+	 */
+	void configureTimers();
+
+	/**
+	 * Arm the timers of every dispatcher relative to the same instant.
+	 */
+	void armTimers();
+
+	/**
+	 * Stop and destroy every timer dispatcher.
 	 */
-	void runTest();
+	void stopTimers();
 
-	// Structures used by the underlying task timer thread
-	struct itimerspec timerSpec;
-	struct sigevent event;
+	/**
+	 * Record the start of the test (the release of every task's first job)
+	 * right before the period timers are armed.
+	 */
+	void startJobs();
 
-	// The scheduler's unique timer ID
-	timer_t timerID;
+	// The threads that service every timer during the test (a single
+	// one unless the tasks are scheduled globally)
+	vector<TimerDispatcher*> dispatchers;
 
 	// The scheduler's base priority used as a limit when determining
 	// all active task priorities.
@@ -134,24 +313,94 @@ private:
 	uint64_t realScheduleTime;
 	uint64_t numScheduleEvents;
 
+	// Distribution of the schedule event times
+	LatencyHistogram scheduleLatency;
+
+	// The proxy scheduler thread's performance counters (if enabled)
+	PerfCounters counters;
+
 	// The type of algorithm being used for this specific test.
 	AlgorithmType algorithmType;
 
 	// Internal collection of tasks that are managed by the scheduler.
 	vector<Task*> tasks;
 
-	// Temporary list of task data used to construct the main list of tasks.
+	// The scheduling keys and statistics of the tasks (read by the scheduling policy).
+	TaskTable taskTable;
+
+	// Temporary list of task data (and task IDs) used to construct the
+	// main list of tasks.
 	vector<TaskData> taskData;
+	vector<unsigned int> taskIDs;
 
-	// Convenience map that associates task ID's with task objects
-	// (used when assigning priorities).
-	map<int, Task*> taskMap;
-	
-	// The current scheduling algorithm object used to determine task priorities.
-	SchedulingAlgorithm* scheduler;
+	// Flags indexed by task ID marking the tasks managed by this scheduler
+	// (the schedule trace is shared by every partition).
+	vector<bool> members;
+
+	// Convenience table that associates task ID's with task objects
+	// (used when assigning priorities, indexed by task ID).
+	vector<Task*> taskMap;
+
+	// The priority most recently assigned to each task (indexed by task ID),
+	// used to skip redundant priority changes.
+	vector<int> appliedPriorities;
+
+	// The rank of every task (indexed by task ID) and the ranks of the tasks
+	// that were released with a compute cycle pending (set on each period
+	// event; a completed task's bit is cleared when topTasks() next finds it)
+	vector<unsigned int> ranks;
+	ReadyMap ready;
+
+	// Number of CPUs (running slots) shared by the tasks
+	unsigned int slots;
+
+	// Flag indicating whether the tasks are scheduled globally (see
+	// setGlobal()); while a global test runs, the policy that every CPU
+	// updates, the lock that guards it (and the ready bitmap), and the
+	// running tasks before and after an event
+	bool global;
+	SchedulingAlgorithm* sharedPolicy;
+	pthread_mutex_t sharedLock;
+	vector<PriorityMove> sharedMoves;
+	vector<unsigned int> sharedPreviousTop;
+	vector<unsigned int> sharedCurrentTop;
+
+	// Flag indicating whether only the top tasks are ranked (see
+	// setDispatchTopOnly()), and the task table slots they were selected from
+	bool dispatchTopOnly;
+	vector<unsigned int> selection;
+
+	// Maximum size of the cyclic-executive table (0 if the test is
+	// scheduled online) and the table itself
+	uint64_t tableBudget;
+	CyclicTable cyclicTable;
+
+	// The pool the tasks are taken from (NULL if the scheduler owns its tasks)
+	TaskPool* pool;
+
+	// The region the live statistics are published in (NULL if none) and
+	// the proxy scheduler's record
+	StatsExport* statsExport;
+	unsigned int statsIndex;
+
+	// Semaphore the proxy scheduler blocks on until a task needs scheduling.
+	sem_t proxySem;
+
+	// Lock-free queue of the IDs of the tasks whose period expired (filled
+	// by the timer dispatcher on any CPU and drained by the proxy scheduler).
+	TaskEventQueue taskEvents;
+
+	// Lock that keeps the logs of concurrent (partitioned) schedulers apart.
+	static pthread_mutex_t logLock;
 
 	// Constant for the initial semaphore value.
 	static const int SEM_COUNT = 0; // Binary semaphore
+
+	// Number of pending task events buffered per task.
+	static const unsigned int TASK_EVENTS_PER_TASK = 4;
+
+	// Marker value for "no priority assigned yet".
+	static const int NO_PRIORITY = -1;
 };
 
 #endif /* PROXYSCHEDULER_H_ */
@@ -25,50 +25,65 @@ RMAlgorithm::~RMAlgorithm()
 {
 }
 
+/**
+ * Allocate every list up front (when the test starts), so that no
+ * later scheduling event allocates.
+ *
+ * @param numTasks - the number of tasks under control of the schedule test
+ * @param idLimit - one more than the largest task ID
+ */
+void RMAlgorithm::reserve(unsigned int numTasks, unsigned int idLimit)
+{
+	SchedulingPolicy<RMAlgorithm>::reserve(numTasks, idLimit);
+	sorted.reserve(numTasks);
+}
+
 /**
  * Apply the RMA algorithm to build a list of task priorities
  * that is then used to reschedule tasks during the schedule test.
  *
- * @param tasks - list of tasks under control of the schedule test
- * @return descending priority list of tasks used for scheduling.
+ * @param table - the tasks under control of the schedule test
+ * @param order - the list the task IDs are appended to in descending priority
  */
-vector<unsigned int> RMAlgorithm::scheduleTasks(vector<Task*> tasks)
+void RMAlgorithm::buildOrder(const TaskTable& table, vector<unsigned int>& order)
 {
-	vector<Task*> sorted;
-	vector<unsigned int> priorities;
+	unsigned int position;
 
-	// Sort the tasks based on the frequency of their period (lower period, higher priority)
-	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	// Sort the task slots based on the frequency of their period (lower period, higher
+	// priority, and a later task ahead of an earlier one with the same period)
+	sorted.clear();
+	for (unsigned int slot = 0; slot < table.size(); slot++)
 	{
-		if (sorted.empty())
-		{
-			// Insert something to start
-			sorted.push_back(*itr);
-		}
-		else
+		position = sorted.size();
+		for (unsigned int i = 0; i < sorted.size(); i++)
 		{
-			bool inserted = false;
-			for (vector<Task*>::iterator pitr = sorted.begin(); pitr != sorted.end(); pitr++)
+			if (table.getPeriodTime(slot) <= table.getPeriodTime(sorted[i]))
 			{
-				if ((*itr)->getPeriodTime() <= (*pitr)->getPeriodTime())
-				{
-					sorted.insert(pitr, *itr);
-					inserted = true;
-					break;
-				}
-			}
-			if (!inserted)
-			{
-				sorted.push_back(*itr);
+				position = i;
+				break;
 			}
 		}
+		sorted.insert(sorted.begin() + position, slot);
 	}
 
-	// Populate the priorities vector based on the now sorted list
-	for (vector<Task*>::iterator itr = sorted.begin(); itr != sorted.end(); itr++)
+	// Populate the priority list based on the now sorted list
+	for (vector<unsigned int>::iterator itr = sorted.begin(); itr != sorted.end(); itr++)
 	{
-		priorities.push_back((*itr)->taskID());
+		order.push_back(table.getTaskID(*itr));
 	}
+}
 
-	return priorities;
+/**
+ * RMA priorities only depend on the (fixed) task periods, so a
+ * period event never moves a task in the priority list.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param id - the ID of the task whose period expired
+ * @param moves - cleared (no task ever moves)
+ */
+void RMAlgorithm::taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+{
+	(void)table;
+	(void)id;
+	moves.clear();
 }
@@ -12,13 +12,13 @@
 #define RMALGORITHM_H_
 
 // Module includes
-#include "SchedulingAlgorithm.h"
+#include "SchedulingPolicy.h"
 
 /**
  * This class is responsible for encapsulating the
  * Rate Monotonic Analysis (RMA) algorithm for scheduling.
  */
-class RMAlgorithm: public SchedulingAlgorithm
+class RMAlgorithm: public SchedulingPolicy<RMAlgorithm>
 {
 public:
 	/**
@@ -29,16 +29,39 @@ public:
 	/**
 	 * Default, empty destructor.
 	 */
-	virtual ~RMAlgorithm();
+	~RMAlgorithm();
+
+	/**
+	 * Allocate every list up front (when the test starts), so that no
+	 * later scheduling event allocates.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int numTasks, unsigned int idLimit);
 
 	/**
 	 * Apply the RMA algorithm to build a list of task priorities
 	 * that is then used to reschedule tasks during the schedule test.
 	 *
-	 * @param tasks - list of tasks under control of the schedule test
-	 * @return descending priority list of tasks used for scheduling.
+	 * @param table - the tasks under control of the schedule test
+	 * @param order - the list the task IDs are appended to in descending priority
 	 */
-	vector<unsigned int> scheduleTasks(vector<Task*> tasks);
+	void buildOrder(const TaskTable& table, vector<unsigned int>& order);
+
+	/**
+	 * RMA priorities only depend on the (fixed) task periods, so a
+	 * period event never moves a task in the priority list.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose period expired
+	 * @param moves - cleared (no task ever moves)
+	 */
+	void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves);
+
+private:
+	// Task slots in descending priority order (kept to avoid reallocation)
+	vector<unsigned int> sorted;
 };
 
 #endif /* RMALGORITHM_H_ */
@@ -0,0 +1,118 @@
+//*****************************************************************
+// ReadyMap.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "ReadyMap.h"
+
+// Static member definitions
+const unsigned int ReadyMap::NO_LEVEL;
+
+/**
+ * Default constructor for an empty map (with no levels).
+ */
+ReadyMap::ReadyMap()
+{
+	reset(0);
+}
+
+/**
+ * Default, empty destructor.
+ */
+ReadyMap::~ReadyMap()
+{
+}
+
+/**
+ * Clear every level and (re)size the map.
+ *
+ * @param levels - the number of priority levels
+ */
+void ReadyMap::reset(unsigned int levels)
+{
+	unsigned int size = levels;
+
+	// Add bitmaps until one word summarizes the one below it
+	words.clear();
+	do
+	{
+		size = (size + WORD_MASK) >> WORD_SHIFT;
+		if (size == 0)
+		{
+			size = 1;
+		}
+		words.push_back(vector<uint64_t>(size, 0));
+	} while (size > 1);
+}
+
+/**
+ * Find the highest priority (lowest) ready level.
+ *
+ * @return the level, or NO_LEVEL if no level is ready
+ */
+unsigned int ReadyMap::first() const
+{
+	const uint64_t root = words.back()[0];
+
+	if (root == 0)
+	{
+		return NO_LEVEL;
+	}
+	return descend(words.size() - 1, __builtin_ctzll(root));
+}
+
+/**
+ * Find the highest priority ready level below a given level.
+ *
+ * @param level - the level to search after
+ * @return the next ready level, or NO_LEVEL if there is none
+ */
+unsigned int ReadyMap::next(unsigned int level) const
+{
+	unsigned int position = level + 1;
+	unsigned int word;
+	uint64_t bits;
+
+	// Look for a later bit in the same word, moving up to the
+	// summary bitmap above whenever the rest of the word is empty
+	for (unsigned int i = 0; i < words.size(); i++)
+	{
+		word = position >> WORD_SHIFT;
+		if (word >= words[i].size())
+		{
+			return NO_LEVEL;
+		}
+		bits = words[i][word] & (~0ULL << (position & WORD_MASK));
+		if (bits != 0)
+		{
+			return descend(i, (word << WORD_SHIFT) + __builtin_ctzll(bits));
+		}
+		position = word + 1;
+	}
+	return NO_LEVEL;
+}
+
+/**
+ * Descend from a set bit of a summary bitmap to the ready level
+ * it leads to.
+ *
+ * @param layer - the bitmap of the set bit (0 is the level bitmap)
+ * @param position - the position of the set bit in that bitmap
+ * @return the ready level
+ */
+unsigned int ReadyMap::descend(unsigned int layer, unsigned int position) const
+{
+	// Each set summary bit leads to a non-empty word below it
+	while (layer > 0)
+	{
+		layer--;
+		position = (position << WORD_SHIFT) + __builtin_ctzll(words[layer][position]);
+	}
+	return position;
+}
@@ -0,0 +1,155 @@
+//*****************************************************************
+// ReadyMap.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef READYMAP_H_
+#define READYMAP_H_
+
+// Module includes
+#include "Project1.h"
+
+/**
+ * This class is a bitmap of the ready priority levels (one bit per rank
+ * in the descending priority list, rank 0 being the highest priority),
+ * in the style of a kernel run queue. The bits are kept in 64-bit words
+ * with a summary bitmap above them (one bit per non-empty word, repeated
+ * until a single word remains), so setting or clearing a level and
+ * finding the highest priority ready level are a few find-first-set
+ * operations, however many levels there are.
+ */
+class ReadyMap
+{
+public:
+	/**
+	 * Default constructor for an empty map (with no levels).
+	 */
+	ReadyMap();
+
+	/**
+	 * Default, empty destructor.
+	 */
+	virtual ~ReadyMap();
+
+	/**
+	 * Clear every level and (re)size the map.
+	 *
+	 * @param levels - the number of priority levels
+	 */
+	void reset(unsigned int levels);
+
+	/**
+	 * Mark a level as ready.
+	 *
+	 * @param level - the priority level
+	 */
+	inline void set(unsigned int level)
+	{
+		uint64_t bit;
+
+		for (unsigned int i = 0; i < words.size(); i++)
+		{
+			bit = 1ULL << (level & WORD_MASK);
+			level >>= WORD_SHIFT;
+			if (words[i][level] != 0)
+			{
+				// The summary bits above are already set
+				words[i][level] |= bit;
+				return;
+			}
+			words[i][level] = bit;
+		}
+	}
+
+	/**
+	 * Mark a level as not ready.
+	 *
+	 * @param level - the priority level
+	 */
+	inline void clear(unsigned int level)
+	{
+		for (unsigned int i = 0; i < words.size(); i++)
+		{
+			uint64_t bit = 1ULL << (level & WORD_MASK);
+			level >>= WORD_SHIFT;
+			words[i][level] &= ~bit;
+			if (words[i][level] != 0)
+			{
+				// The word is still non-empty, so the summary bits are unchanged
+				return;
+			}
+		}
+	}
+
+	/**
+	 * Mark a level as ready or not ready.
+	 *
+	 * @param level - the priority level
+	 * @param ready - true if the level is ready
+	 */
+	inline void assign(unsigned int level, bool ready)
+	{
+		if (ready)
+		{
+			set(level);
+		}
+		else
+		{
+			clear(level);
+		}
+	}
+
+	/**
+	 * Determine whether a level is ready.
+	 *
+	 * @param level - the priority level
+	 * @return true if the level is ready
+	 */
+	inline bool test(unsigned int level) const
+	{
+		return (words[0][level >> WORD_SHIFT] & (1ULL << (level & WORD_MASK))) != 0;
+	}
+
+	/**
+	 * Find the highest priority (lowest) ready level.
+	 *
+	 * @return the level, or NO_LEVEL if no level is ready
+	 */
+	unsigned int first() const;
+
+	/**
+	 * Find the highest priority ready level below a given level.
+	 *
+	 * @param level - the level to search after
+	 * @return the next ready level, or NO_LEVEL if there is none
+	 */
+	unsigned int next(unsigned int level) const;
+
+	// Level value for "no ready level"
+	static const unsigned int NO_LEVEL = 0xFFFFFFFF;
+
+private:
+	// Bits per word, as a shift and a mask
+	static const unsigned int WORD_SHIFT = 6;
+	static const unsigned int WORD_MASK = 63;
+
+	/**
+	 * Descend from a set bit of a summary bitmap to the ready level
+	 * it leads to.
+	 *
+	 * @param layer - the bitmap of the set bit (0 is the level bitmap)
+	 * @param position - the position of the set bit in that bitmap
+	 * @return the ready level
+	 */
+	unsigned int descend(unsigned int layer, unsigned int position) const;
+
+	// The level bitmap followed by each summary bitmap (the last is a single word)
+	vector<vector<uint64_t> > words;
+};
+
+#endif /* READYMAP_H_ */
@@ -0,0 +1,759 @@
+//*****************************************************************
+// ResultsTable.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "ResultsTable.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Private constants
+#define BYTE_ORDER_MARK (0x01020304U)
+#define HEADER_WORDS    (8)
+#define ALIGNMENT       (8)
+
+// A TDATA line
+typedef struct
+{
+	unsigned int uid;
+	unsigned int deadlineEvents;
+	unsigned int deadlinesMissed;
+	double timeMissed;
+	double totalCompute;
+	unsigned int cycles;
+	double transition;
+	double realCompute;
+	double error;
+} TaskLine;
+
+// An experiment being parsed from a log
+struct ResultsTable::ParsedExperiment
+{
+	unsigned int source;
+	int algorithm;
+	int runtime;
+	int numTasks;
+	vector<TaskData> pairs;
+	unsigned int missed;
+	unsigned int traceLength;
+	bool started;
+	unsigned int startLine;
+	bool havePData;
+	double schedOverhead;
+	double realRuntime;
+	double runtimeError;
+	vector<TaskLine> tasks;
+
+	ParsedExperiment()
+	{
+		source = 0;
+		algorithm = -1;
+		runtime = -1;
+		numTasks = -1;
+		missed = 0;
+		traceLength = 0;
+		started = false;
+		startLine = 0;
+		havePData = false;
+		schedOverhead = 0;
+		realRuntime = 0;
+		runtimeError = 0;
+	}
+};
+
+/**
+ * Order experiment rows by algorithm, task count and utilization.
+ */
+struct ExperimentOrder
+{
+	const ResultsTable* table;
+
+	ExperimentOrder(const ResultsTable* table) : table(table) {}
+
+	bool operator()(unsigned int a, unsigned int b) const
+	{
+		const vector<uint32_t>& algorithm = table->uintColumns[EXP_ALGORITHM];
+		const vector<uint32_t>& numTasks = table->uintColumns[EXP_NUM_TASKS];
+		const vector<double>& utilization = table->doubleColumns[EXP_UTILIZATION];
+
+		if (algorithm[a] != algorithm[b])
+		{
+			return algorithm[a] < algorithm[b];
+		}
+		if (numTasks[a] != numTasks[b])
+		{
+			return numTasks[a] < numTasks[b];
+		}
+		return utilization[a] < utilization[b];
+	}
+};
+
+/**
+ * Parse the integer answer that follows a prompt, if the log echoes it.
+ *
+ * @param line - the log line
+ * @param prompt - the prompt text
+ * @param value - the parsed value
+ * @return true if the prompt was found (whether or not a value follows)
+ */
+static bool promptValue(const string& line, const char* prompt, int& value)
+{
+	size_t pos = line.find(prompt);
+	const char* start;
+	char* end;
+	long parsed;
+
+	if (pos == string::npos)
+	{
+		return false;
+	}
+
+	start = line.c_str() + pos + strlen(prompt);
+	parsed = strtol(start, &end, 10);
+	if (end != start)
+	{
+		value = (int)parsed;
+	}
+	return true;
+}
+
+/**
+ * Write zero padding up to the next alignment boundary.
+ *
+ * @param file - the output file
+ * @param size - the number of bytes written so far in the section
+ */
+static void pad(FILE* file, size_t size)
+{
+	static const char zeros[ALIGNMENT] = { 0 };
+	fwrite(zeros, 1, (ALIGNMENT - (size % ALIGNMENT)) % ALIGNMENT, file);
+}
+
+/**
+ * Round a size up to the alignment boundary.
+ *
+ * @param size - the size
+ * @return the aligned size
+ */
+static size_t aligned(size_t size)
+{
+	return (size + ALIGNMENT - 1) & ~((size_t)ALIGNMENT - 1);
+}
+
+/**
+ * Default constructor for an empty table.
+ */
+ResultsTable::ResultsTable()
+{
+	data = NULL;
+	length = 0;
+	experimentCount = 0;
+	taskRowCount = 0;
+	index = NULL;
+	indexEntries = 0;
+	memset(columns, 0, sizeof(columns));
+}
+
+/**
+ * Default destructor that unmaps the open file (if any).
+ */
+ResultsTable::~ResultsTable()
+{
+	close();
+}
+
+/**
+ * Parse a schedule test log and append its experiments to the table.
+ * Records are found anywhere in a line (the test threads interleave their
+ * output) and every MISSED record is counted. Unknown lines are ignored and
+ * experiments without an echoed algorithm choice or a PDATA line are
+ * dropped (with a warning if the test ran).
+ *
+ * @param path - the log file
+ * @param source - the name that identifies the log (e.g. "EDF_new")
+ * @return number of experiments added, or -1 if the log could not be read
+ */
+int ResultsTable::ingest(const char* path, const string& source)
+{
+	ifstream log(path);
+	ParsedExperiment experiment;
+	unsigned int sourceIndex;
+	unsigned int compute;
+	unsigned int period;
+	bool active = false;
+	bool readingPairs = false;
+	int added = 0;
+	unsigned int lineNumber = 0;
+	string::size_type position;
+	string::size_type end;
+	string line;
+
+	if (!log)
+	{
+		return -1;
+	}
+
+	// Register the source name
+	sourceIndex = find(sources.begin(), sources.end(), source) - sources.begin();
+	if (sourceIndex == sources.size())
+	{
+		sources.push_back(source);
+	}
+
+	while (getline(log, line))
+	{
+		lineNumber++;
+
+		// The logs were captured on Windows as well
+		if (!line.empty() && line[line.size() - 1] == '\r')
+		{
+			line.erase(line.size() - 1);
+		}
+
+		// A new experiment starts at the algorithm prompt
+		if (line.find("Algorithm choice:") != string::npos)
+		{
+			if (active && appendExperiment(experiment))
+			{
+				added++;
+			}
+			experiment = ParsedExperiment();
+			experiment.source = sourceIndex;
+			active = true;
+			readingPairs = false;
+		}
+
+		// The prompts may all share one line when stdin is redirected
+		if (promptValue(line, "Algorithm choice:", experiment.algorithm) |
+				promptValue(line, "Test runtime:", experiment.runtime) |
+				promptValue(line, "Number of tasks:", experiment.numTasks))
+		{
+			readingPairs = (line.find("Task data") != string::npos);
+			continue;
+		}
+		if (line.find("Task data") != string::npos)
+		{
+			readingPairs = true;
+			continue;
+		}
+
+		// Compute/period pairs follow the task data prompt
+		if (readingPairs && sscanf(line.c_str(), "%u %u", &compute, &period) == 2)
+		{
+			TaskData pair;
+			pair.computeTime = compute;
+			pair.periodTime = period;
+			experiment.pairs.push_back(pair);
+			continue;
+		}
+		readingPairs = false;
+
+		// Results (the task and proxy threads share stdout, so a record may
+		// follow other output on the same line, e.g. "2MISSED PDATA ...")
+		for (position = line.find("MISSED"); position != string::npos; position = line.find("MISSED", position + 6))
+		{
+			experiment.missed++;
+		}
+		if (!experiment.started && line.find("START") != string::npos)
+		{
+			experiment.started = true;
+			experiment.startLine = lineNumber;
+		}
+		if ((position = line.find("TRACE ")) != string::npos)
+		{
+			// The trace ends at the first character that is not part of it
+			end = line.find_first_not_of("0123456789,", position + 6);
+			experiment.traceLength = count(line.begin() + position,
+					(end == string::npos) ? line.end() : line.begin() + end, ',');
+		}
+		if ((position = line.find("PDATA ")) != string::npos)
+		{
+			experiment.havePData = (sscanf(line.c_str() + position + 6, "%lf,%lf,%lf", &experiment.schedOverhead,
+					&experiment.realRuntime, &experiment.runtimeError) == 3);
+		}
+		if ((position = line.find("TDATA ")) != string::npos)
+		{
+			TaskLine task;
+			if (sscanf(line.c_str() + position + 6, "%u,%u,%u,%lf,%lf,%u,%lf,%lf,%lf", &task.uid,
+					&task.deadlineEvents, &task.deadlinesMissed, &task.timeMissed, &task.totalCompute,
+					&task.cycles, &task.transition, &task.realCompute, &task.error) == 9)
+			{
+				experiment.tasks.push_back(task);
+			}
+		}
+	}
+
+	if (active && appendExperiment(experiment))
+	{
+		added++;
+	}
+	return added;
+}
+
+/**
+ * Append a parsed experiment to the ingested columns if it is complete.
+ *
+ * @param experiment - the parsed experiment
+ * @return true if the experiment was kept
+ */
+bool ResultsTable::appendExperiment(const ParsedExperiment& experiment)
+{
+	unsigned int row = uintColumns[EXP_SOURCE].size();
+	unsigned int firstTask = uintColumns[TASK_EXPERIMENT].size();
+	double utilization = 0;
+
+	if (experiment.started && !experiment.havePData)
+	{
+		cerr << "Warning: " << sources[experiment.source] << " test started at line " <<
+				experiment.startLine << " has no PDATA line (dropped)" << endl;
+	}
+	if (!experiment.havePData || experiment.algorithm < 0)
+	{
+		return false;
+	}
+
+	for (vector<TaskData>::const_iterator itr = experiment.pairs.begin(); itr != experiment.pairs.end(); itr++)
+	{
+		if ((*itr).periodTime > 0)
+		{
+			utilization += (double)(*itr).computeTime / (double)(*itr).periodTime;
+		}
+	}
+
+	uintColumns[EXP_SOURCE].push_back(experiment.source);
+	uintColumns[EXP_ALGORITHM].push_back(experiment.algorithm);
+	uintColumns[EXP_RUNTIME].push_back((experiment.runtime < 0) ? 0 : experiment.runtime);
+	uintColumns[EXP_NUM_TASKS].push_back((experiment.numTasks < 0) ? experiment.tasks.size() : experiment.numTasks);
+	doubleColumns[EXP_UTILIZATION].push_back(utilization);
+	uintColumns[EXP_MISSED].push_back(experiment.missed);
+	uintColumns[EXP_TRACE_LENGTH].push_back(experiment.traceLength);
+	doubleColumns[EXP_SCHED_OVERHEAD].push_back(experiment.schedOverhead);
+	doubleColumns[EXP_REAL_RUNTIME].push_back(experiment.realRuntime);
+	doubleColumns[EXP_RUNTIME_ERROR].push_back(experiment.runtimeError);
+	uintColumns[EXP_FIRST_TASK].push_back(firstTask);
+	uintColumns[EXP_TASK_ROWS].push_back(experiment.tasks.size());
+
+	for (vector<TaskLine>::const_iterator itr = experiment.tasks.begin(); itr != experiment.tasks.end(); itr++)
+	{
+		const TaskLine& task = *itr;
+		bool known = (task.uid < experiment.pairs.size());
+
+		uintColumns[TASK_EXPERIMENT].push_back(row);
+		uintColumns[TASK_ID].push_back(task.uid);
+		uintColumns[TASK_COMPUTE].push_back(known ? experiment.pairs[task.uid].computeTime : 0);
+		uintColumns[TASK_PERIOD].push_back(known ? experiment.pairs[task.uid].periodTime : 0);
+		uintColumns[TASK_DEADLINE_EVENTS].push_back(task.deadlineEvents);
+		uintColumns[TASK_DEADLINES_MISSED].push_back(task.deadlinesMissed);
+		doubleColumns[TASK_TIME_MISSED].push_back(task.timeMissed);
+		doubleColumns[TASK_TOTAL_COMPUTE].push_back(task.totalCompute);
+		uintColumns[TASK_CYCLES].push_back(task.cycles);
+		doubleColumns[TASK_TRANSITION].push_back(task.transition);
+		doubleColumns[TASK_REAL_COMPUTE].push_back(task.realCompute);
+		doubleColumns[TASK_ERROR].push_back(task.error);
+	}
+
+	return true;
+}
+
+/**
+ * Write the ingested experiments to a columnar results file.
+ *
+ * @param path - the file to create (or truncate)
+ * @return true on success, false if the file could not be written
+ */
+bool ResultsTable::write(const char* path)
+{
+	unsigned int experiments = uintColumns[EXP_SOURCE].size();
+	unsigned int taskRows = uintColumns[TASK_EXPERIMENT].size();
+	vector<unsigned int> order(experiments);
+	vector<unsigned int> taskOrder;
+	vector<ResultsIndexEntry> groups;
+	vector<uint32_t> firstTask(experiments);
+	vector<uint32_t> taskExperiment;
+	uint32_t header[HEADER_WORDS];
+	size_t sourceBytes = 0;
+	uint64_t offset;
+	bool success;
+	FILE* file;
+
+	// Sort the experiments and lay their task rows out in the same order
+	for (unsigned int i = 0; i < experiments; i++)
+	{
+		order[i] = i;
+	}
+	stable_sort(order.begin(), order.end(), ExperimentOrder(this));
+	for (unsigned int i = 0; i < experiments; i++)
+	{
+		unsigned int row = order[i];
+		firstTask[i] = taskOrder.size();
+		for (unsigned int t = 0; t < uintColumns[EXP_TASK_ROWS][row]; t++)
+		{
+			taskOrder.push_back(uintColumns[EXP_FIRST_TASK][row] + t);
+			taskExperiment.push_back(i);
+		}
+
+		// Start a new index group when the algorithm or task count changes
+		if (groups.empty() || groups.back().algorithm != uintColumns[EXP_ALGORITHM][row] ||
+				groups.back().numTasks != uintColumns[EXP_NUM_TASKS][row])
+		{
+			ResultsIndexEntry entry;
+			entry.algorithm = uintColumns[EXP_ALGORITHM][row];
+			entry.numTasks = uintColumns[EXP_NUM_TASKS][row];
+			entry.firstRow = i;
+			entry.rows = 0;
+			groups.push_back(entry);
+		}
+		groups.back().rows++;
+	}
+
+	file = fopen(path, "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	// Header and source names
+	for (vector<string>::iterator itr = sources.begin(); itr != sources.end(); itr++)
+	{
+		sourceBytes += (*itr).size() + 1;
+	}
+	memcpy(&header[0], RESULTS_MAGIC, 4);
+	header[1] = BYTE_ORDER_MARK;
+	header[2] = RESULTS_VERSION;
+	header[3] = sources.size();
+	header[4] = experiments;
+	header[5] = taskRows;
+	header[6] = COLUMN_LAST_ENTRY;
+	header[7] = groups.size();
+	fwrite(header, sizeof(uint32_t), HEADER_WORDS, file);
+	for (vector<string>::iterator itr = sources.begin(); itr != sources.end(); itr++)
+	{
+		fwrite((*itr).c_str(), 1, (*itr).size() + 1, file);
+	}
+	pad(file, sourceBytes);
+
+	// Column directory
+	offset = (HEADER_WORDS * sizeof(uint32_t)) + aligned(sourceBytes) +
+			(COLUMN_LAST_ENTRY * 16) + (groups.size() * sizeof(ResultsIndexEntry));
+	offset = aligned(offset);
+	for (int column = 0; column < COLUMN_LAST_ENTRY; column++)
+	{
+		uint32_t entry[2];
+		unsigned int rows = (column < TASK_EXPERIMENT) ? experiments : taskRows;
+		entry[0] = column;
+		entry[1] = columnType((ColumnID)column);
+		fwrite(entry, sizeof(uint32_t), 2, file);
+		fwrite(&offset, sizeof(offset), 1, file);
+		offset += aligned(rows * ((entry[1] == COLUMN_TYPE_DOUBLE) ? sizeof(double) : sizeof(uint32_t)));
+	}
+
+	// Index
+	if (!groups.empty())
+	{
+		fwrite(&groups[0], sizeof(ResultsIndexEntry), groups.size(), file);
+	}
+	pad(file, groups.size() * sizeof(ResultsIndexEntry));
+
+	// Columns, in the sorted row order
+	for (int column = 0; column < COLUMN_LAST_ENTRY; column++)
+	{
+		const vector<unsigned int>& rowOrder = (column < TASK_EXPERIMENT) ? order : taskOrder;
+		size_t bytes;
+
+		if (columnType((ColumnID)column) == COLUMN_TYPE_DOUBLE)
+		{
+			for (vector<unsigned int>::const_iterator itr = rowOrder.begin(); itr != rowOrder.end(); itr++)
+			{
+				fwrite(&doubleColumns[column][*itr], sizeof(double), 1, file);
+			}
+			bytes = rowOrder.size() * sizeof(double);
+		}
+		else if (column == EXP_FIRST_TASK || column == TASK_EXPERIMENT)
+		{
+			// Row references must follow the new order
+			const vector<uint32_t>& values = (column == EXP_FIRST_TASK) ? firstTask : taskExperiment;
+			if (!values.empty())
+			{
+				fwrite(&values[0], sizeof(uint32_t), values.size(), file);
+			}
+			bytes = values.size() * sizeof(uint32_t);
+		}
+		else
+		{
+			for (vector<unsigned int>::const_iterator itr = rowOrder.begin(); itr != rowOrder.end(); itr++)
+			{
+				fwrite(&uintColumns[column][*itr], sizeof(uint32_t), 1, file);
+			}
+			bytes = rowOrder.size() * sizeof(uint32_t);
+		}
+		pad(file, bytes);
+	}
+
+	success = (ferror(file) == 0);
+	if (fclose(file) != 0)
+	{
+		success = false;
+	}
+	return success;
+}
+
+/**
+ * Map a results file written by write().
+ *
+ * @param path - the file to open
+ * @return true on success, false if the file is missing or malformed
+ */
+bool ResultsTable::open(const char* path)
+{
+	const uint32_t* header;
+	const unsigned char* directory;
+	struct stat info;
+	void* mapping;
+	size_t position;
+	int fd;
+
+	close();
+
+	fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+	if (fstat(fd, &info) != 0 || (size_t)info.st_size < HEADER_WORDS * sizeof(uint32_t))
+	{
+		::close(fd);
+		return false;
+	}
+	mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+	data = (const unsigned char*)mapping;
+	length = info.st_size;
+
+	// Validate the header
+	header = (const uint32_t*)data;
+	if (memcmp(data, RESULTS_MAGIC, 4) != 0 || header[1] != BYTE_ORDER_MARK ||
+			header[2] != RESULTS_VERSION || header[6] != COLUMN_LAST_ENTRY)
+	{
+		close();
+		return false;
+	}
+	experimentCount = header[4];
+	taskRowCount = header[5];
+	indexEntries = header[7];
+
+	// Source names
+	position = HEADER_WORDS * sizeof(uint32_t);
+	for (unsigned int i = 0; i < header[3]; i++)
+	{
+		const char* name = (const char*)(data + position);
+		size_t nameLength = strnlen(name, length - position);
+		if (position + nameLength >= length)
+		{
+			close();
+			return false;
+		}
+		sources.push_back(string(name, nameLength));
+		position += nameLength + 1;
+	}
+	position = aligned(position);
+
+	// Column directory and index
+	directory = data + position;
+	position += (COLUMN_LAST_ENTRY * 16);
+	index = (const ResultsIndexEntry*)(data + position);
+	position += indexEntries * sizeof(ResultsIndexEntry);
+	if (position > length)
+	{
+		close();
+		return false;
+	}
+	for (int column = 0; column < COLUMN_LAST_ENTRY; column++)
+	{
+		const uint32_t* entry = (const uint32_t*)(directory + (column * 16));
+		uint64_t offset;
+		unsigned int rows = (column < TASK_EXPERIMENT) ? experimentCount : taskRowCount;
+
+		memcpy(&offset, directory + (column * 16) + 8, sizeof(offset));
+		if (entry[0] != (uint32_t)column || entry[1] != (uint32_t)columnType((ColumnID)column) ||
+				offset + (uint64_t)rows * ((entry[1] == COLUMN_TYPE_DOUBLE) ? sizeof(double) : sizeof(uint32_t)) > length)
+		{
+			close();
+			return false;
+		}
+		columns[column] = data + offset;
+	}
+
+	return true;
+}
+
+/**
+ * Unmap the open file (if any).
+ */
+void ResultsTable::close()
+{
+	if (data != NULL)
+	{
+		munmap((void*)data, length);
+		sources.clear();
+	}
+	data = NULL;
+	length = 0;
+	experimentCount = 0;
+	taskRowCount = 0;
+	index = NULL;
+	indexEntries = 0;
+	memset(columns, 0, sizeof(columns));
+}
+
+/**
+ * Retrieve the number of experiment rows in the open file.
+ *
+ * @return number of experiments
+ */
+unsigned int ResultsTable::getExperimentCount() const
+{
+	return experimentCount;
+}
+
+/**
+ * Retrieve the number of task rows in the open file.
+ *
+ * @return number of task rows
+ */
+unsigned int ResultsTable::getTaskRowCount() const
+{
+	return taskRowCount;
+}
+
+/**
+ * Retrieve the source names of the open file.
+ *
+ * @return the source names (indexed by EXP_SOURCE)
+ */
+const vector<string>& ResultsTable::getSources() const
+{
+	return sources;
+}
+
+/**
+ * Retrieve an unsigned integer column of the open file.
+ *
+ * @param column - the column
+ * @return the column array, or NULL if the column is not an integer column
+ */
+const uint32_t* ResultsTable::getUint32Column(ColumnID column) const
+{
+	if (column >= COLUMN_LAST_ENTRY || columnType(column) != COLUMN_TYPE_UINT32)
+	{
+		return NULL;
+	}
+	return (const uint32_t*)columns[column];
+}
+
+/**
+ * Retrieve a floating point column of the open file.
+ *
+ * @param column - the column
+ * @return the column array, or NULL if the column is not a double column
+ */
+const double* ResultsTable::getDoubleColumn(ColumnID column) const
+{
+	if (column >= COLUMN_LAST_ENTRY || columnType(column) != COLUMN_TYPE_DOUBLE)
+	{
+		return NULL;
+	}
+	return (const double*)columns[column];
+}
+
+/**
+ * Look up the experiment rows of an (algorithm, task count) group.
+ *
+ * @param alg - the algorithm
+ * @param numTasks - the task count
+ * @param first - the first row of the group
+ * @param rows - the number of rows in the group
+ * @return true if the group exists
+ */
+bool ResultsTable::findGroup(AlgorithmType alg, unsigned int numTasks, unsigned int& first, unsigned int& rows) const
+{
+	for (unsigned int i = 0; i < indexEntries; i++)
+	{
+		if (index[i].algorithm == (uint32_t)alg && index[i].numTasks == numTasks)
+		{
+			first = index[i].firstRow;
+			rows = index[i].rows;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Narrow a row range (sorted by utilization) to a utilization interval.
+ *
+ * @param first - the first row of the range (updated)
+ * @param rows - the number of rows of the range (updated)
+ * @param minUtilization - the lower utilization bound (inclusive)
+ * @param maxUtilization - the upper utilization bound (inclusive)
+ */
+void ResultsTable::narrowUtilization(unsigned int& first, unsigned int& rows,
+		double minUtilization, double maxUtilization) const
+{
+	const double* utilization = getDoubleColumn(EXP_UTILIZATION);
+	const double* begin = lower_bound(utilization + first, utilization + first + rows, minUtilization);
+	const double* end = upper_bound(begin, utilization + first + rows, maxUtilization);
+
+	first = begin - utilization;
+	rows = end - begin;
+}
+
+/**
+ * Retrieve the index entries of the open file.
+ *
+ * @param entries - the number of index entries
+ * @return the (algorithm, task count) groups in row order
+ */
+const ResultsIndexEntry* ResultsTable::getIndex(unsigned int& entries) const
+{
+	entries = indexEntries;
+	return index;
+}
+
+/**
+ * Retrieve the type of a column.
+ *
+ * @param column - the column
+ * @return the column type
+ */
+ColumnType ResultsTable::columnType(ColumnID column)
+{
+	switch (column)
+	{
+	case EXP_UTILIZATION:
+	case EXP_SCHED_OVERHEAD:
+	case EXP_REAL_RUNTIME:
+	case EXP_RUNTIME_ERROR:
+	case TASK_TIME_MISSED:
+	case TASK_TOTAL_COMPUTE:
+	case TASK_TRANSITION:
+	case TASK_REAL_COMPUTE:
+	case TASK_ERROR:
+		return COLUMN_TYPE_DOUBLE;
+	default:
+		return COLUMN_TYPE_UINT32;
+	}
+}
@@ -0,0 +1,241 @@
+//*****************************************************************
+// ResultsTable.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef RESULTSTABLE_H_
+#define RESULTSTABLE_H_
+
+// Module includes
+#include "Project1.h"
+
+/*
+ * Columnar results file layout (host byte order, checked on open):
+ *
+ *   header          magic ("RTJR"), byte order mark, version, number of
+ *                   sources, experiments, task rows, columns and index
+ *                   entries (8 x 32-bit)
+ *   sources         NUL-terminated source names (padded to 8 bytes)
+ *   directory       one {column ID, type, offset (64-bit)} per column
+ *   index           one {algorithm, task count, first row, rows} per group
+ *   columns         contiguous column arrays (8-byte aligned)
+ *
+ * Experiment rows are sorted by algorithm, task count and utilization, so
+ * the index maps each (algorithm, task count) group to a row range that is
+ * in turn sorted by utilization.
+ */
+#define RESULTS_MAGIC   "RTJR"
+#define RESULTS_VERSION (1)
+
+// Column types
+typedef enum
+{
+	COLUMN_TYPE_UINT32,
+	COLUMN_TYPE_DOUBLE
+} ColumnType;
+
+// Column IDs (experiment columns, then task columns)
+typedef enum
+{
+	EXP_SOURCE,          // uint32: index into the source names
+	EXP_ALGORITHM,       // uint32: AlgorithmType
+	EXP_RUNTIME,         // uint32: requested test runtime (seconds)
+	EXP_NUM_TASKS,       // uint32
+	EXP_UTILIZATION,     // double: sum of compute/period
+	EXP_MISSED,          // uint32: MISSED lines
+	EXP_TRACE_LENGTH,    // uint32: entries in the TRACE line
+	EXP_SCHED_OVERHEAD,  // double: PDATA average scheduling time (seconds)
+	EXP_REAL_RUNTIME,    // double: PDATA measured runtime (seconds)
+	EXP_RUNTIME_ERROR,   // double: PDATA runtime error
+	EXP_FIRST_TASK,      // uint32: first row in the task columns
+	EXP_TASK_ROWS,       // uint32: number of TDATA rows
+	TASK_EXPERIMENT,     // uint32: experiment row
+	TASK_ID,             // uint32
+	TASK_COMPUTE,        // uint32: compute time (ms)
+	TASK_PERIOD,         // uint32: period (ms)
+	TASK_DEADLINE_EVENTS,// uint32
+	TASK_DEADLINES_MISSED,// uint32
+	TASK_TIME_MISSED,    // double: compute time missed (ns)
+	TASK_TOTAL_COMPUTE,  // double: total compute time (ms)
+	TASK_CYCLES,         // uint32: completed compute cycles
+	TASK_TRANSITION,     // double: transition/real compute time
+	TASK_REAL_COMPUTE,   // double: real compute time (ms)
+	TASK_ERROR,          // double: compute time error
+	COLUMN_LAST_ENTRY
+} ColumnID;
+
+// Index entry for one (algorithm, task count) group
+typedef struct
+{
+	uint32_t algorithm;
+	uint32_t numTasks;
+	uint32_t firstRow;
+	uint32_t rows;
+} ResultsIndexEntry;
+
+/**
+ * This class turns the stdout logs of schedule tests (prompts, START/STOP,
+ * MISSED, TRACE, PDATA and TDATA lines) into a columnar results table.
+ * Logs are ingested into memory and written out once; a written table is
+ * memory-mapped on open and its columns are exposed as plain arrays.
+ */
+class ResultsTable
+{
+public:
+	/**
+	 * Default constructor for an empty table.
+	 */
+	ResultsTable();
+
+	/**
+	 * Default destructor that unmaps the open file (if any).
+	 */
+	virtual ~ResultsTable();
+
+	/**
+	 * Parse a schedule test log and append its experiments to the table.
+	 * Records are found anywhere in a line (the test threads interleave their
+	 * output) and every MISSED record is counted. Unknown lines are ignored and
+	 * experiments without an echoed algorithm choice or a PDATA line are
+	 * dropped (with a warning if the test ran).
+	 *
+	 * @param path - the log file
+	 * @param source - the name that identifies the log (e.g. "EDF_new")
+	 * @return number of experiments added, or -1 if the log could not be read
+	 */
+	int ingest(const char* path, const string& source);
+
+	/**
+	 * Write the ingested experiments to a columnar results file.
+	 *
+	 * @param path - the file to create (or truncate)
+	 * @return true on success, false if the file could not be written
+	 */
+	bool write(const char* path);
+
+	/**
+	 * Map a results file written by write().
+	 *
+	 * @param path - the file to open
+	 * @return true on success, false if the file is missing or malformed
+	 */
+	bool open(const char* path);
+
+	/**
+	 * Unmap the open file (if any).
+	 */
+	void close();
+
+	/**
+	 * Retrieve the number of experiment rows in the open file.
+	 *
+	 * @return number of experiments
+	 */
+	unsigned int getExperimentCount() const;
+
+	/**
+	 * Retrieve the number of task rows in the open file.
+	 *
+	 * @return number of task rows
+	 */
+	unsigned int getTaskRowCount() const;
+
+	/**
+	 * Retrieve the source names of the open file.
+	 *
+	 * @return the source names (indexed by EXP_SOURCE)
+	 */
+	const vector<string>& getSources() const;
+
+	/**
+	 * Retrieve an unsigned integer column of the open file.
+	 *
+	 * @param column - the column
+	 * @return the column array, or NULL if the column is not an integer column
+	 */
+	const uint32_t* getUint32Column(ColumnID column) const;
+
+	/**
+	 * Retrieve a floating point column of the open file.
+	 *
+	 * @param column - the column
+	 * @return the column array, or NULL if the column is not a double column
+	 */
+	const double* getDoubleColumn(ColumnID column) const;
+
+	/**
+	 * Look up the experiment rows of an (algorithm, task count) group.
+	 *
+	 * @param alg - the algorithm
+	 * @param numTasks - the task count
+	 * @param first - the first row of the group
+	 * @param rows - the number of rows in the group
+	 * @return true if the group exists
+	 */
+	bool findGroup(AlgorithmType alg, unsigned int numTasks, unsigned int& first, unsigned int& rows) const;
+
+	/**
+	 * Narrow a row range (sorted by utilization) to a utilization interval.
+	 *
+	 * @param first - the first row of the range (updated)
+	 * @param rows - the number of rows of the range (updated)
+	 * @param minUtilization - the lower utilization bound (inclusive)
+	 * @param maxUtilization - the upper utilization bound (inclusive)
+	 */
+	void narrowUtilization(unsigned int& first, unsigned int& rows,
+			double minUtilization, double maxUtilization) const;
+
+	/**
+	 * Retrieve the index entries of the open file.
+	 *
+	 * @param entries - the number of index entries
+	 * @return the (algorithm, task count) groups in row order
+	 */
+	const ResultsIndexEntry* getIndex(unsigned int& entries) const;
+
+private:
+	// Ingested columns (only the vector matching each column's type is used)
+	vector<uint32_t> uintColumns[COLUMN_LAST_ENTRY];
+	vector<double> doubleColumns[COLUMN_LAST_ENTRY];
+
+	// Source names (ingested or read from the open file)
+	vector<string> sources;
+
+	// Mapped file contents
+	const unsigned char* data;
+	size_t length;
+	unsigned int experimentCount;
+	unsigned int taskRowCount;
+	const void* columns[COLUMN_LAST_ENTRY];
+	const ResultsIndexEntry* index;
+	unsigned int indexEntries;
+
+	// An experiment being parsed from a log (defined in the source file)
+	struct ParsedExperiment;
+
+	// The sort order of the experiment rows needs the ingested columns
+	friend struct ExperimentOrder;
+
+	/**
+	 * Retrieve the type of a column.
+	 *
+	 * @param column - the column
+	 * @return the column type
+	 */
+	static ColumnType columnType(ColumnID column);
+
+	/**
+	 * Append a parsed experiment to the ingested columns if it is complete.
+	 *
+	 * @param experiment - the parsed experiment
+	 * @return true if the experiment was kept
+	 */
+	bool appendExperiment(const ParsedExperiment& experiment);
+};
+
+#endif /* RESULTSTABLE_H_ */
@@ -25,50 +25,84 @@ SCTAlgorithm::~SCTAlgorithm()
 {
 }
 
+/**
+ * Allocate every list up front (when the test starts), so that no
+ * later scheduling event allocates.
+ *
+ * @param numTasks - the number of tasks under control of the schedule test
+ * @param idLimit - one more than the largest task ID
+ */
+void SCTAlgorithm::reserve(unsigned int numTasks, unsigned int idLimit)
+{
+	SchedulingPolicy<SCTAlgorithm>::reserve(numTasks, idLimit);
+	readyQueue.reserve(numTasks, idLimit);
+}
+
 /**
  * Apply the SCT algorithm to build a list of task priorities
  * that is then used to reschedule tasks during the schedule test.
  *
- * @param tasks - list of tasks under control of the schedule test
- * @return descending priority list of tasks used for scheduling.
+ * @param table - the tasks under control of the schedule test
+ * @param order - the list the task IDs are appended to in descending priority
  */
-vector<unsigned int> SCTAlgorithm::scheduleTasks(vector<Task*> tasks)
+void SCTAlgorithm::buildOrder(const TaskTable& table, vector<unsigned int>& order)
 {
-	vector<Task*> sorted;
-	vector<unsigned int> priorities;
+	unsigned int id;
+	uint64_t key;
 
-	// Sort the tasks based on the frequency of their period (lower period, higher priority)
-	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	// Update the key of every task whose remaining compute time changed
+	// since the last event (shortest remaining time, higher priority)
+	for (unsigned int slot = 0; slot < table.size(); slot++)
 	{
-		if (priorities.empty())
+		id = table.getTaskID(slot);
+		key = table.getRemainingTime(slot);
+		if (!readyQueue.contains(id))
 		{
-			// Insert something to start
-			sorted.push_back(*itr);
+			readyQueue.push(id, key);
 		}
-		else
+		else if (readyQueue.key(id) != key)
 		{
-			bool inserted = false;
-			for (vector<Task*>::iterator pitr = sorted.begin(); pitr != sorted.end(); pitr++)
-			{
-				if ((*itr)->remainingTime() <= (*pitr)->remainingTime())
-				{
-					sorted.insert(pitr, *pitr);
-					inserted = true;
-					break;
-				}
-			}
-			if (!inserted)
-			{
-				sorted.push_back(*itr);
-			}
+			readyQueue.update(id, key);
 		}
 	}
 
-	// Populate the priorities vector based on the now sorted list
-	for (vector<Task*>::iterator itr = sorted.begin(); itr != sorted.end(); itr++)
+	// Populate the priority list in ascending key order
+	order.reserve(order.size() + table.size());
+	readyQueue.topK(table.size(), order);
+}
+
+/**
+ * Re-key every task whose remaining compute time changed since the last
+ * event (the task whose period expired and the tasks that ran) and binary
+ * search each one's new rank in the current priority list, so only the
+ * tasks they pass over change rank. The tasks are re-ranked one at a
+ * time, which keeps the rest of the list ordered by their queued keys.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param id - the ID of the task whose period expired
+ * @param moves - filled with the new rank of every task that moved
+ */
+void SCTAlgorithm::taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+{
+	unsigned int changed;
+	uint64_t key;
+
+	// Fall back to a full rebuild if the order was never initialized.
+	if (!readyQueue.contains(id) || getOrder().empty())
 	{
-		priorities.push_back((*itr)->taskID());
+		SchedulingPolicy<SCTAlgorithm>::taskChanged(table, id, moves);
+		return;
 	}
 
-	return priorities;
+	moves.clear();
+	for (unsigned int slot = 0; slot < table.size(); slot++)
+	{
+		changed = table.getTaskID(slot);
+		key = table.getRemainingTime(slot);
+		if (readyQueue.key(changed) != key)
+		{
+			readyQueue.update(changed, key);
+			rerankTask(changed, readyQueue, moves);
+		}
+	}
 }
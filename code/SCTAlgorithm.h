@@ -12,13 +12,14 @@
 #define SCTALGORITHM_H_
 
 // Module includes
-#include "SchedulingAlgorithm.h"
+#include "SchedulingPolicy.h"
+#include "TaskHeap.h"
 
 /**
  * This class is responsible for encapsulating the
  * Shortest Completion Time (SCT) algorithm for scheduling.
  */
-class SCTAlgorithm: public SchedulingAlgorithm
+class SCTAlgorithm: public SchedulingPolicy<SCTAlgorithm>
 {
 public:
 	/**
@@ -29,16 +30,40 @@ public:
 	/**
 	 * Default, empty destructor.
 	 */
-	virtual ~SCTAlgorithm();
+	~SCTAlgorithm();
+
+	/**
+	 * Allocate every list up front (when the test starts), so that no
+	 * later scheduling event allocates.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int numTasks, unsigned int idLimit);
 
 	/**
 	 * Apply the SCT algorithm to build a list of task priorities
 	 * that is then used to reschedule tasks during the schedule test.
 	 *
-	 * @param tasks - list of tasks under control of the schedule test
-	 * @return descending priority list of tasks used for scheduling.
+	 * @param table - the tasks under control of the schedule test
+	 * @param order - the list the task IDs are appended to in descending priority
 	 */
-	vector<unsigned int> scheduleTasks(vector<Task*> tasks);
+	void buildOrder(const TaskTable& table, vector<unsigned int>& order);
+
+	/**
+	 * Re-key every task whose remaining compute time changed since the last
+	 * event and binary search each one's new rank in the current priority
+	 * list, so only the tasks they pass over change rank.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose period expired
+	 * @param moves - filled with the new rank of every task that moved
+	 */
+	void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves);
+
+private:
+	// Persistent ready queue keyed by each task's remaining compute time
+	TaskHeap readyQueue;
 };
 
 #endif /* SCTALGORITHM_H_ */
@@ -0,0 +1,539 @@
+//*****************************************************************
+// Schedulability.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "Schedulability.h"
+#include <algorithm>
+#include <cmath>
+
+// Static member definitions
+const uint64_t Schedulability::NO_BOUND;
+const uint64_t Schedulability::US_PER_MS;
+const unsigned int Schedulability::MAX_EDF_OFFSETS;
+const uint64_t Schedulability::MAX_EDF_WORK;
+
+// Tolerance for floating point utilization sums
+#define UTILIZATION_EPSILON (1e-9)
+
+// Response times beyond this horizon (us, about 35 years) are treated as
+// unbounded so a rounding error in the overload check can never hang the
+// fixed-point iterations
+#define HORIZON (1ULL << 50)
+
+/**
+ * Task ordering for RMA (shorter period first); ties are broken the way
+ * RMAlgorithm breaks them (the later task first).
+ */
+struct RateMonotonicOrder
+{
+	const vector<TaskData>* taskSet;
+
+	bool operator()(unsigned int a, unsigned int b) const
+	{
+		if ((*taskSet)[a].periodTime != (*taskSet)[b].periodTime)
+		{
+			return (*taskSet)[a].periodTime < (*taskSet)[b].periodTime;
+		}
+		return a > b;
+	}
+};
+
+/**
+ * Analyze a task set for the given algorithm.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @param alg - the scheduling algorithm
+ * @param analysis - set to the verdict, bounds and response times
+ * @return the verdict
+ */
+SchedVerdict Schedulability::analyze(const vector<TaskData>& taskSet, AlgorithmType alg, SchedAnalysis& analysis)
+{
+	uint64_t busy;
+	unsigned int shortestPeriod = 0;
+
+	analysis.utilization = utilization(taskSet);
+	analysis.liuLayland = liuLaylandTest(taskSet);
+	analysis.hyperbolic = hyperbolicTest(taskSet);
+	analysis.responseTimes.assign(taskSet.size(), NO_BOUND);
+
+	// A task without a period can never be scheduled
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		if ((*itr).periodTime == 0)
+		{
+			analysis.verdict = SCHED_INFEASIBLE;
+			return analysis.verdict;
+		}
+		if (shortestPeriod == 0 || (*itr).periodTime < shortestPeriod)
+		{
+			shortestPeriod = (*itr).periodTime;
+		}
+	}
+
+	switch (alg)
+	{
+	case ALGORITHM_TYPE_RMA:
+		analysis.verdict = responseTimeAnalysis(taskSet, analysis.responseTimes);
+		break;
+	case ALGORITHM_TYPE_EDF:
+		analysis.verdict = processorDemandAnalysis(taskSet);
+		edfResponseTimes(taskSet, analysis.responseTimes);
+		break;
+	case ALGORITHM_TYPE_SCT:
+	default:
+		// Every job completes within the busy period it is released in
+		busy = busyPeriod(taskSet);
+		analysis.responseTimes.assign(taskSet.size(), busy);
+		if (busy == NO_BOUND)
+		{
+			analysis.verdict = SCHED_INFEASIBLE;
+		}
+		else if (busy <= shortestPeriod * US_PER_MS)
+		{
+			analysis.verdict = SCHED_FEASIBLE;
+		}
+		else
+		{
+			analysis.verdict = SCHED_UNKNOWN;
+		}
+		break;
+	}
+
+	return analysis.verdict;
+}
+
+/**
+ * Retrieve the total utilization of a task set.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @return the sum of compute/period
+ */
+double Schedulability::utilization(const vector<TaskData>& taskSet)
+{
+	double total = 0;
+
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		if ((*itr).periodTime > 0)
+		{
+			total += (double)(*itr).computeTime / (*itr).periodTime;
+		}
+	}
+	return total;
+}
+
+/**
+ * Retrieve the Liu & Layland utilization bound n(2^(1/n) - 1).
+ *
+ * @param numTasks - the number of tasks
+ * @return the utilization bound
+ */
+double Schedulability::liuLaylandBound(unsigned int numTasks)
+{
+	if (numTasks == 0)
+	{
+		return 1.0;
+	}
+	return numTasks * (pow(2.0, 1.0 / numTasks) - 1.0);
+}
+
+/**
+ * Apply the (sufficient) Liu & Layland test for RMA.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @return true if the utilization is within the bound
+ */
+bool Schedulability::liuLaylandTest(const vector<TaskData>& taskSet)
+{
+	return utilization(taskSet) <= liuLaylandBound(taskSet.size()) + UTILIZATION_EPSILON;
+}
+
+/**
+ * Apply the (sufficient, and tighter) hyperbolic bound for RMA:
+ * the product of (U_i + 1) is at most 2.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @return true if the task set is within the bound
+ */
+bool Schedulability::hyperbolicTest(const vector<TaskData>& taskSet)
+{
+	double product = 1.0;
+
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		if ((*itr).periodTime == 0)
+		{
+			return false;
+		}
+		product *= ((double)(*itr).computeTime / (*itr).periodTime) + 1.0;
+	}
+	return product <= 2.0 + UTILIZATION_EPSILON;
+}
+
+/**
+ * Compute the worst-case response time of every task under RMA (exact
+ * response-time analysis, over every job of the level-i busy period).
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @param responseTimes - set to each task's response time (us)
+ * @return SCHED_FEASIBLE if every response time is within its deadline
+ */
+SchedVerdict Schedulability::responseTimeAnalysis(const vector<TaskData>& taskSet, vector<uint64_t>& responseTimes)
+{
+	vector<unsigned int> order;
+	RateMonotonicOrder rateMonotonic;
+	SchedVerdict verdict = SCHED_FEASIBLE;
+	double higherUtilization = 0;
+	uint64_t firstWindow = 0; // the previous task's first job window
+	uint64_t window;
+	uint64_t next;
+	uint64_t response;
+
+	responseTimes.assign(taskSet.size(), NO_BOUND);
+	for (unsigned int i = 0; i < taskSet.size(); i++)
+	{
+		order.push_back(i);
+	}
+	rateMonotonic.taskSet = &taskSet;
+	sort(order.begin(), order.end(), rateMonotonic);
+
+	for (unsigned int p = 0; p < order.size(); p++)
+	{
+		unsigned int i = order[p];
+		uint64_t compute = (uint64_t)taskSet[i].computeTime * US_PER_MS;
+		uint64_t period = (uint64_t)taskSet[i].periodTime * US_PER_MS;
+		double taskUtilization = (double)taskSet[i].computeTime / taskSet[i].periodTime;
+
+		// The level-i busy period never ends if the CPU is overloaded at this level
+		if (higherUtilization + taskUtilization > 1.0 + UTILIZATION_EPSILON)
+		{
+			verdict = SCHED_INFEASIBLE;
+			higherUtilization += taskUtilization;
+			continue;
+		}
+
+		// Examine each job q of the level-i busy period. The first window
+		// starts from two lower bounds on its fixed point: the previous
+		// task's window plus our compute time, and C / (1 - U(hp)).
+		response = 0;
+		window = firstWindow + compute;
+		if (higherUtilization < 1.0)
+		{
+			next = (uint64_t)floor((compute / (1.0 - higherUtilization)) * (1.0 - UTILIZATION_EPSILON));
+			window = (next > window) ? next : window;
+		}
+		for (uint64_t q = 0; window < HORIZON; q++)
+		{
+			for (;;)
+			{
+				next = (q + 1) * compute;
+				for (unsigned int h = 0; h < p; h++)
+				{
+					next += divideUp(window, (uint64_t)taskSet[order[h]].periodTime * US_PER_MS) *
+							taskSet[order[h]].computeTime * US_PER_MS;
+				}
+				if (next <= window)
+				{
+					break;
+				}
+				window = next;
+				if (window >= HORIZON)
+				{
+					break;
+				}
+			}
+			if (window >= HORIZON)
+			{
+				break;
+			}
+			if (q == 0)
+			{
+				firstWindow = window;
+			}
+			if (window - (q * period) > response)
+			{
+				response = window - (q * period);
+			}
+
+			// The busy period ends before the next job is released
+			if (window <= (q + 1) * period)
+			{
+				responseTimes[i] = response;
+				break;
+			}
+			window += compute; // lower bound for the next job's window
+		}
+
+		if (responseTimes[i] == NO_BOUND || responseTimes[i] > period)
+		{
+			verdict = SCHED_INFEASIBLE;
+		}
+		higherUtilization += taskUtilization;
+	}
+
+	return verdict;
+}
+
+/**
+ * Decide EDF schedulability exactly with Quick Processor-demand Analysis.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @return SCHED_FEASIBLE or SCHED_INFEASIBLE
+ */
+SchedVerdict Schedulability::processorDemandAnalysis(const vector<TaskData>& taskSet)
+{
+	double total = utilization(taskSet);
+	uint64_t longestDeadline = 0;
+	uint64_t horizon;
+	uint64_t shortestDeadline = NO_BOUND;
+	uint64_t t;
+	uint64_t demand;
+	uint64_t deadline;
+
+	if (total > 1.0 + UTILIZATION_EPSILON)
+	{
+		return SCHED_INFEASIBLE;
+	}
+
+	// Deadlines only need to be checked up to the busy period, or up to
+	// max(D_max, sum((T - D) * U) / (1 - U)) when the CPU has idle time.
+	horizon = busyPeriod(taskSet);
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		deadline = (uint64_t)(*itr).periodTime * US_PER_MS;
+		shortestDeadline = (deadline < shortestDeadline) ? deadline : shortestDeadline;
+		longestDeadline = (deadline > longestDeadline) ? deadline : longestDeadline;
+	}
+	if (total < 1.0 - UTILIZATION_EPSILON && longestDeadline < horizon)
+	{
+		// Every deadline equals its period, so sum((T - D) * U) is zero.
+		horizon = longestDeadline + 1;
+	}
+
+	// Start from the largest absolute deadline before the horizon and walk
+	// backwards, jumping straight to the demand whenever it is below t.
+	t = 0;
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		uint64_t period = (uint64_t)(*itr).periodTime * US_PER_MS;
+		if (period < horizon)
+		{
+			deadline = ((horizon - 1) / period) * period;
+			t = (deadline > t) ? deadline : t;
+		}
+	}
+
+	while (t > 0)
+	{
+		// Processor demand of every job with its deadline in [0, t]
+		demand = 0;
+		for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+		{
+			uint64_t period = (uint64_t)(*itr).periodTime * US_PER_MS;
+			demand += (t / period) * (*itr).computeTime * US_PER_MS;
+		}
+
+		if (demand > t)
+		{
+			return SCHED_INFEASIBLE;
+		}
+		if (demand <= shortestDeadline)
+		{
+			break;
+		}
+		if (demand < t)
+		{
+			t = demand;
+		}
+		else
+		{
+			// Move on to the largest absolute deadline before t
+			deadline = 0;
+			for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+			{
+				uint64_t period = (uint64_t)(*itr).periodTime * US_PER_MS;
+				if (period < t)
+				{
+					uint64_t previous = ((t - 1) / period) * period;
+					deadline = (previous > deadline) ? previous : deadline;
+				}
+			}
+			t = deadline;
+		}
+	}
+
+	return SCHED_FEASIBLE;
+}
+
+/**
+ * Compute the worst-case response time of every task under EDF
+ * (Spuri's analysis over the release offsets in the busy period). The
+ * analysis is cubic in the number of tasks, so for large task sets the
+ * remaining tasks are bounded by their deadlines once a work budget is spent.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @param responseTimes - set to each task's response time (us)
+ */
+void Schedulability::edfResponseTimes(const vector<TaskData>& taskSet, vector<uint64_t>& responseTimes)
+{
+	vector<uint64_t> offsets;
+	uint64_t busy = busyPeriod(taskSet);
+	uint64_t work = 0;
+	uint64_t window;
+	uint64_t next;
+	uint64_t response;
+
+	responseTimes.assign(taskSet.size(), NO_BOUND);
+	if (busy == NO_BOUND)
+	{
+		return;
+	}
+
+	for (unsigned int i = 0; i < taskSet.size(); i++)
+	{
+		uint64_t compute = (uint64_t)taskSet[i].computeTime * US_PER_MS;
+		uint64_t deadline = (uint64_t)taskSet[i].periodTime * US_PER_MS;
+		bool truncated = false;
+
+		// The worst case is a release of task i at an offset a in the busy
+		// period where some other task's deadline coincides with a + D_i.
+		offsets.clear();
+		for (unsigned int j = 0; j < taskSet.size() && !truncated; j++)
+		{
+			uint64_t period = (uint64_t)taskSet[j].periodTime * US_PER_MS;
+			uint64_t first = (period >= deadline) ? period - deadline : period - (deadline % period);
+			first = (first >= period) ? first - period : first;
+			for (uint64_t a = first; a + compute < busy || a == 0; a += period)
+			{
+				if (offsets.size() >= MAX_EDF_OFFSETS)
+				{
+					truncated = true;
+					break;
+				}
+				offsets.push_back(a);
+			}
+		}
+
+		// Too many offsets to examine: the response time of a feasible
+		// EDF task set is bounded by the deadline.
+		work += (uint64_t)offsets.size() * taskSet.size();
+		if (truncated || work > MAX_EDF_WORK)
+		{
+			responseTimes[i] = deadline;
+			continue;
+		}
+		sort(offsets.begin(), offsets.end());
+		offsets.erase(unique(offsets.begin(), offsets.end()), offsets.end());
+
+		// The window of a later offset is never shorter, so each fixed
+		// point iteration starts from the previous one.
+		response = compute;
+		window = 0;
+		for (vector<uint64_t>::iterator a = offsets.begin(); a != offsets.end(); a++)
+		{
+			uint64_t absoluteDeadline = *a + deadline;
+			uint64_t own = ((*a / deadline) + 1) * compute;
+
+			window = (own > window) ? own : window;
+			for (;;)
+			{
+				next = own;
+				for (unsigned int j = 0; j < taskSet.size(); j++)
+				{
+					uint64_t period = (uint64_t)taskSet[j].periodTime * US_PER_MS;
+					if (j == i || period > absoluteDeadline)
+					{
+						continue;
+					}
+					uint64_t released = divideUp(window, period);
+					uint64_t due = ((absoluteDeadline - period) / period) + 1;
+					next += ((released < due) ? released : due) * taskSet[j].computeTime * US_PER_MS;
+				}
+				if (next <= window)
+				{
+					break;
+				}
+				window = next;
+				if (window >= HORIZON)
+				{
+					break;
+				}
+			}
+			if (window >= HORIZON)
+			{
+				response = NO_BOUND;
+				break;
+			}
+			if (window > *a && window - *a > response)
+			{
+				response = window - *a;
+			}
+		}
+		responseTimes[i] = response;
+	}
+}
+
+/**
+ * Compute the length of the synchronous busy period (the longest
+ * interval in which the CPU is never idle).
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @return the busy period (us), or NO_BOUND if the CPU is overloaded
+ */
+uint64_t Schedulability::busyPeriod(const vector<TaskData>& taskSet)
+{
+	uint64_t window = 0;
+	uint64_t next;
+
+	if (utilization(taskSet) > 1.0 + UTILIZATION_EPSILON)
+	{
+		return NO_BOUND;
+	}
+
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		window += (uint64_t)(*itr).computeTime * US_PER_MS;
+	}
+	while (window > 0 && window < HORIZON)
+	{
+		next = 0;
+		for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+		{
+			next += divideUp(window, (uint64_t)(*itr).periodTime * US_PER_MS) * (*itr).computeTime * US_PER_MS;
+		}
+		if (next == window)
+		{
+			return window;
+		}
+		window = next;
+	}
+
+	return (window == 0) ? 0 : NO_BOUND;
+}
+
+/**
+ * Retrieve the name of a verdict.
+ *
+ * @param verdict - the verdict
+ * @return "feasible", "infeasible" or "unknown"
+ */
+const char* Schedulability::verdictName(SchedVerdict verdict)
+{
+	switch (verdict)
+	{
+	case SCHED_FEASIBLE:
+		return "feasible";
+	case SCHED_INFEASIBLE:
+		return "infeasible";
+	case SCHED_UNKNOWN:
+	default:
+		return "unknown";
+	}
+}
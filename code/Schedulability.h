@@ -0,0 +1,164 @@
+//*****************************************************************
+// Schedulability.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef SCHEDULABILITY_H_
+#define SCHEDULABILITY_H_
+
+// Module includes
+#include "Project1.h"
+
+// Enumeration of the schedulability verdicts
+typedef enum
+{
+	SCHED_FEASIBLE,   // every deadline is guaranteed to be met
+	SCHED_INFEASIBLE, // some deadline is guaranteed to be missed
+	SCHED_UNKNOWN     // the analysis is not exact for this algorithm
+} SchedVerdict;
+
+// Result of analyzing a task set (response times are in microseconds and
+// indexed like the task set; NO_BOUND marks an unbounded response time)
+typedef struct
+{
+	SchedVerdict verdict;
+	double utilization;
+	bool liuLayland;
+	bool hyperbolic;
+	vector<uint64_t> responseTimes;
+} SchedAnalysis;
+
+/**
+ * This class is responsible for deciding offline whether a task set is
+ * schedulable on one CPU, so infeasible sets can be rejected before a
+ * live run. Every task's deadline is the end of its period.
+ *
+ * RMA is decided exactly by response-time analysis, EDF exactly by
+ * Quick Processor-demand Analysis (QPA) with per-task response times from
+ * Spuri's busy period analysis. SCT has no exact test: it is rejected if
+ * the CPU is overloaded and accepted if the longest busy period (which
+ * bounds the response time of any work-conserving policy) fits in the
+ * shortest deadline.
+ *
+ * NOTE: ALL METHODS ARE STATIC
+ */
+class Schedulability
+{
+public:
+	/**
+	 * Analyze a task set for the given algorithm.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param alg - the scheduling algorithm
+	 * @param analysis - set to the verdict, bounds and response times
+	 * @return the verdict
+	 */
+	static SchedVerdict analyze(const vector<TaskData>& taskSet, AlgorithmType alg, SchedAnalysis& analysis);
+
+	/**
+	 * Retrieve the total utilization of a task set.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @return the sum of compute/period
+	 */
+	static double utilization(const vector<TaskData>& taskSet);
+
+	/**
+	 * Retrieve the Liu & Layland utilization bound n(2^(1/n) - 1).
+	 *
+	 * @param numTasks - the number of tasks
+	 * @return the utilization bound
+	 */
+	static double liuLaylandBound(unsigned int numTasks);
+
+	/**
+	 * Apply the (sufficient) Liu & Layland test for RMA.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @return true if the utilization is within the bound
+	 */
+	static bool liuLaylandTest(const vector<TaskData>& taskSet);
+
+	/**
+	 * Apply the (sufficient, and tighter) hyperbolic bound for RMA:
+	 * the product of (U_i + 1) is at most 2.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @return true if the task set is within the bound
+	 */
+	static bool hyperbolicTest(const vector<TaskData>& taskSet);
+
+	/**
+	 * Compute the worst-case response time of every task under RMA (exact
+	 * response-time analysis, over every job of the level-i busy period).
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param responseTimes - set to each task's response time (us)
+	 * @return SCHED_FEASIBLE if every response time is within its deadline
+	 */
+	static SchedVerdict responseTimeAnalysis(const vector<TaskData>& taskSet, vector<uint64_t>& responseTimes);
+
+	/**
+	 * Decide EDF schedulability exactly with Quick Processor-demand Analysis.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @return SCHED_FEASIBLE or SCHED_INFEASIBLE
+	 */
+	static SchedVerdict processorDemandAnalysis(const vector<TaskData>& taskSet);
+
+	/**
+	 * Compute the worst-case response time of every task under EDF
+	 * (Spuri's analysis over the release offsets in the busy period). The
+	 * analysis is cubic in the number of tasks, so for large task sets the
+	 * remaining tasks are bounded by their deadlines once a work budget is spent.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param responseTimes - set to each task's response time (us)
+	 */
+	static void edfResponseTimes(const vector<TaskData>& taskSet, vector<uint64_t>& responseTimes);
+
+	/**
+	 * Compute the length of the synchronous busy period (the longest
+	 * interval in which the CPU is never idle).
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @return the busy period (us), or NO_BOUND if the CPU is overloaded
+	 */
+	static uint64_t busyPeriod(const vector<TaskData>& taskSet);
+
+	/**
+	 * Retrieve the name of a verdict.
+	 *
+	 * @param verdict - the verdict
+	 * @return "feasible", "infeasible" or "unknown"
+	 */
+	static const char* verdictName(SchedVerdict verdict);
+
+	// Response time of a task that can be delayed without bound
+	static const uint64_t NO_BOUND = 0xFFFFFFFFFFFFFFFFULL;
+
+private:
+	/**
+	 * Ceiling of an integer division.
+	 */
+	static inline uint64_t divideUp(uint64_t a, uint64_t b)
+	{
+		return (a + b - 1) / b;
+	}
+
+	// Microseconds per millisecond (task times are in milliseconds)
+	static const uint64_t US_PER_MS = 1000;
+
+	// Most release offsets examined per task, and most offset/task pairs
+	// examined in total, by edfResponseTimes() before it falls back to the
+	// deadline (which bounds the response time in a feasible EDF task set)
+	static const unsigned int MAX_EDF_OFFSETS = 65536;
+	static const uint64_t MAX_EDF_WORK = 1ULL << 26;
+};
+
+#endif /* SCHEDULABILITY_H_ */
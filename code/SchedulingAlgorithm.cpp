@@ -9,6 +9,9 @@
 //*****************************************************************
 
 #include "SchedulingAlgorithm.h"
+#include "RMAlgorithm.h"
+#include "EDFAlgorithm.h"
+#include "SCTAlgorithm.h"
 
 /**
  * Default, empty constructor.
@@ -24,3 +27,88 @@ SchedulingAlgorithm::~SchedulingAlgorithm()
 {
 }
 
+
+/**
+ * Construct the scheduling algorithm object for the given algorithm type.
+ *
+ * @param type - the algorithm type
+ * @return new algorithm object (owned by the caller), or NULL if the
+ *         type is invalid
+ */
+SchedulingAlgorithm* SchedulingAlgorithm::create(AlgorithmType type)
+{
+	switch (type)
+	{
+	case ALGORITHM_TYPE_RMA:
+		return new PolicyAlgorithm<RMAlgorithm>();
+	case ALGORITHM_TYPE_EDF:
+		return new PolicyAlgorithm<EDFAlgorithm>();
+	case ALGORITHM_TYPE_SCT:
+		return new PolicyAlgorithm<SCTAlgorithm>();
+	default:
+		return NULL;
+	}
+}
+
+/**
+ * Allocate every list up front (when the test starts), so that no
+ * later scheduling event allocates.
+ *
+ * @param numTasks - the number of tasks under control of the schedule test
+ * @param idLimit - one more than the largest task ID
+ */
+void SchedulingAlgorithm::reserve(unsigned int numTasks, unsigned int idLimit)
+{
+	SchedulingPolicy<SchedulingAlgorithm>::reserve(numTasks, idLimit);
+}
+
+/**
+ * Rebuild the priority list from scratch and remember it as the
+ * current order for subsequent incremental updates.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param moves - filled with the rank of every task
+ */
+void SchedulingAlgorithm::resetOrder(const TaskTable& table, vector<PriorityMove>& moves)
+{
+	SchedulingPolicy<SchedulingAlgorithm>::resetOrder(table, moves);
+}
+
+/**
+ * Incrementally update the current priority list after the
+ * scheduling key of a single task changed (e.g. a period event).
+ * The default implementation rebuilds the full list with
+ * scheduleTasks() and reports the ranks that differ; algorithms
+ * that can locate the new rank directly should override it.
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param id - the ID of the task whose key changed
+ * @param moves - filled with the new rank of every task that moved
+ */
+void SchedulingAlgorithm::taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+{
+	SchedulingPolicy<SchedulingAlgorithm>::taskChanged(table, id, moves);
+}
+
+/**
+ * Retrieve the current descending priority list.
+ *
+ * @return descending priority list of task IDs
+ */
+const vector<unsigned int>& SchedulingAlgorithm::getOrder() const
+{
+	return SchedulingPolicy<SchedulingAlgorithm>::getOrder();
+}
+
+/**
+ * Append the descending priority list built by scheduleTasks()
+ * (the SchedulingPolicy hook).
+ *
+ * @param table - the tasks under control of the schedule test
+ * @param order - the list the task IDs are appended to
+ */
+void SchedulingAlgorithm::buildOrder(const TaskTable& table, vector<unsigned int>& order)
+{
+	vector<unsigned int> priorities = scheduleTasks(table);
+	order.insert(order.end(), priorities.begin(), priorities.end());
+}
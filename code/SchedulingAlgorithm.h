@@ -14,17 +14,20 @@
 // Module includes
 #include "Task.h"
 #include "Project1.h"
+#include "SchedulingPolicy.h"
 
 // Resolve forward dependency
 class Task;
 
 /**
- * This is the interface/abstract class for all scheduling algorithms that
- * are used in the schedule test. It provides a default scheduler method
+ * This is the interface/abstract class for pluggable scheduling algorithms
+ * that are selected at runtime. It provides a default scheduler method
  * that assigns builds a priority list of tasks based on the current
- * set of tasks under control by the proxy scheduler.
+ * set of tasks under control by the proxy scheduler. The built-in
+ * algorithms (RMAlgorithm, EDFAlgorithm and SCTAlgorithm) are compile-time
+ * policies instead; create() wraps them in this interface.
  */
-class SchedulingAlgorithm
+class SchedulingAlgorithm : public SchedulingPolicy<SchedulingAlgorithm>
 {
 public:
 	/**
@@ -37,14 +40,141 @@ public:
 	 */
 	virtual ~SchedulingAlgorithm();
 
+	/**
+	 * Construct the scheduling algorithm object for the given algorithm type.
+	 *
+	 * @param type - the algorithm type
+	 * @return new algorithm object (owned by the caller), or NULL if the
+	 *         type is invalid
+	 */
+	static SchedulingAlgorithm* create(AlgorithmType type);
+
 	/**
 	 * This is the abstract method that is invoked by the proxy
 	 * scheduler to reschedule tasks during the schedule test.
 	 *
-	 * @param tasks - list of tasks under control of the schedule test
+	 * @param table - the tasks under control of the schedule test
 	 * @return descending priority list of tasks used for scheduling.
 	 */
-	virtual vector<unsigned int> scheduleTasks(vector<Task*> tasks) = 0;
+	virtual vector<unsigned int> scheduleTasks(const TaskTable& table) = 0;
+
+	/**
+	 * Allocate every list up front (when the test starts), so that no
+	 * later scheduling event allocates.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	virtual void reserve(unsigned int numTasks, unsigned int idLimit);
+
+	/**
+	 * Rebuild the priority list from scratch and remember it as the
+	 * current order for subsequent incremental updates.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param moves - filled with the rank of every task
+	 */
+	virtual void resetOrder(const TaskTable& table, vector<PriorityMove>& moves);
+
+	/**
+	 * Incrementally update the current priority list after the
+	 * scheduling key of a single task changed (e.g. a period event).
+	 * The default implementation rebuilds the full list with
+	 * scheduleTasks() and reports the ranks that differ; algorithms
+	 * that can locate the new rank directly should override it.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose key changed
+	 * @param moves - filled with the new rank of every task that moved
+	 */
+	virtual void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves);
+
+	/**
+	 * Retrieve the current descending priority list.
+	 *
+	 * @return descending priority list of task IDs
+	 */
+	virtual const vector<unsigned int>& getOrder() const;
+
+	/**
+	 * Append the descending priority list built by scheduleTasks()
+	 * (the SchedulingPolicy hook).
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param order - the list the task IDs are appended to
+	 */
+	void buildOrder(const TaskTable& table, vector<unsigned int>& order);
+};
+
+/**
+ * This class template adapts a compile-time scheduling policy to the
+ * runtime SchedulingAlgorithm interface (for code that selects the
+ * algorithm at runtime, such as the simulator).
+ */
+template <class Policy>
+class PolicyAlgorithm : public SchedulingAlgorithm
+{
+public:
+	/**
+	 * Build the descending priority list with the policy.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @return descending priority list of tasks used for scheduling.
+	 */
+	vector<unsigned int> scheduleTasks(const TaskTable& table)
+	{
+		vector<unsigned int> priorities;
+		policy.buildOrder(table, priorities);
+		return priorities;
+	}
+
+	/**
+	 * Allocate every list of the policy up front.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int numTasks, unsigned int idLimit)
+	{
+		policy.reserve(numTasks, idLimit);
+	}
+
+	/**
+	 * Rebuild the policy's priority list from scratch.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param moves - filled with the rank of every task
+	 */
+	void resetOrder(const TaskTable& table, vector<PriorityMove>& moves)
+	{
+		policy.resetOrder(table, moves);
+	}
+
+	/**
+	 * Update the policy's priority list after a task's key changed.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose key changed
+	 * @param moves - filled with the new rank of every task that moved
+	 */
+	void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+	{
+		policy.taskChanged(table, id, moves);
+	}
+
+	/**
+	 * Retrieve the policy's descending priority list.
+	 *
+	 * @return descending priority list of task IDs
+	 */
+	const vector<unsigned int>& getOrder() const
+	{
+		return policy.getOrder();
+	}
+
+private:
+	// The adapted policy
+	Policy policy;
 };
 
 #endif /* SCHEDULINGALGORITHM_H_ */
@@ -0,0 +1,272 @@
+//*****************************************************************
+// SchedulingPolicy.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef SCHEDULINGPOLICY_H_
+#define SCHEDULINGPOLICY_H_
+
+// Module includes
+#include "Project1.h"
+#include "TaskTable.h"
+#include "TaskHeap.h"
+
+// A single change to a task's rank in the descending priority list
+// (rank 0 is the highest priority task)
+typedef struct
+{
+	unsigned int taskID;
+	unsigned int rank;
+} PriorityMove;
+
+/**
+ * This class template keeps the descending priority list of a scheduling
+ * policy and the ranks of its tasks. A policy derives from it with itself
+ * as the template argument (CRTP) and provides
+ *
+ *   void buildOrder(const TaskTable& table, vector<unsigned int>& order);
+ *
+ * which appends every task ID in descending priority order. A policy may
+ * also hide taskChanged() with an incremental version, and reserve() to
+ * allocate its own lists up front. Every call is
+ * resolved at compile time, so a scheduler that is instantiated with a
+ * concrete policy has no virtual dispatch, and since every list is kept
+ * between events a scheduling event does not allocate.
+ */
+template <class Policy>
+class SchedulingPolicy
+{
+public:
+	/**
+	 * Allocate every list up front (when the test starts), so that no
+	 * later scheduling event allocates.
+	 *
+	 * @param numTasks - the number of tasks under control of the schedule test
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int numTasks, unsigned int idLimit)
+	{
+		order.reserve(numTasks);
+		scratch.reserve(numTasks);
+		if (idLimit > rank.size())
+		{
+			rank.resize(idLimit, 0);
+		}
+	}
+
+	/**
+	 * Rebuild the priority list from scratch and remember it as the
+	 * current order for subsequent incremental updates.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param moves - filled with the rank of every task
+	 */
+	void resetOrder(const TaskTable& table, vector<PriorityMove>& moves)
+	{
+		PriorityMove move;
+
+		order.clear();
+		static_cast<Policy*>(this)->buildOrder(table, order);
+		moves.clear();
+
+		// Rebuild the rank index and report every rank.
+		for (unsigned int i = 0; i < order.size(); i++)
+		{
+			if (order[i] >= rank.size())
+			{
+				rank.resize(order[i] + 1, 0);
+			}
+			rank[order[i]] = i;
+			move.taskID = order[i];
+			move.rank = i;
+			moves.push_back(move);
+		}
+	}
+
+	/**
+	 * Incrementally update the current priority list after the
+	 * scheduling key of a single task changed (e.g. a period event).
+	 * The default implementation rebuilds the full list and reports
+	 * the ranks that differ; policies that can locate the new rank
+	 * directly should hide it.
+	 *
+	 * @param table - the tasks under control of the schedule test
+	 * @param id - the ID of the task whose key changed
+	 * @param moves - filled with the new rank of every task that moved
+	 */
+	void taskChanged(const TaskTable& table, unsigned int id, vector<PriorityMove>& moves)
+	{
+		(void)id; // the full list is rebuilt
+		moves.clear();
+		scratch.clear();
+		static_cast<Policy*>(this)->buildOrder(table, scratch);
+		replaceOrder(scratch, moves);
+	}
+
+	/**
+	 * Retrieve the current descending priority list.
+	 *
+	 * @return descending priority list of task IDs
+	 */
+	const vector<unsigned int>& getOrder() const
+	{
+		return order;
+	}
+
+protected:
+	/**
+	 * Move a task to a new rank in the current priority list, shifting
+	 * the tasks in between by one rank.
+	 *
+	 * @param id - the task ID
+	 * @param newRank - the task's new rank
+	 * @param moves - appended with every task whose rank changed
+	 */
+	void moveTask(unsigned int id, unsigned int newRank, vector<PriorityMove>& moves)
+	{
+		unsigned int oldRank = rank[id];
+		unsigned int r;
+		PriorityMove move;
+
+		if (newRank == oldRank)
+		{
+			return;
+		}
+
+		// Shift the tasks between the old and new rank towards the vacated slot.
+		if (newRank > oldRank)
+		{
+			for (r = oldRank; r < newRank; r++)
+			{
+				order[r] = order[r + 1];
+				rank[order[r]] = r;
+				move.taskID = order[r];
+				move.rank = r;
+				moves.push_back(move);
+			}
+		}
+		else
+		{
+			for (r = oldRank; r > newRank; r--)
+			{
+				order[r] = order[r - 1];
+				rank[order[r]] = r;
+				move.taskID = order[r];
+				move.rank = r;
+				moves.push_back(move);
+			}
+		}
+
+		order[newRank] = id;
+		rank[id] = newRank;
+		move.taskID = id;
+		move.rank = newRank;
+		moves.push_back(move);
+	}
+
+	/**
+	 * Binary search the new rank of a task whose key changed among the
+	 * other tasks of the current priority list (which must still be
+	 * ordered by their keys in the queue) and move it there, so only the
+	 * tasks it passes over change rank.
+	 *
+	 * @param id - the task ID
+	 * @param queue - the ready queue that holds every task's current key
+	 * @param moves - appended with every task whose rank changed
+	 */
+	void rerankTask(unsigned int id, const TaskHeap& queue, vector<PriorityMove>& moves)
+	{
+		unsigned int oldRank = rank[id];
+		unsigned int low = 0;
+		unsigned int high = order.size() - 1;
+		unsigned int mid;
+		unsigned int other;
+
+		// Search the list of all other tasks (skipping the task itself)
+		// for the first one that is not ordered before the changed task.
+		while (low < high)
+		{
+			mid = (low + high) / 2;
+			other = order[(mid < oldRank) ? mid : mid + 1];
+			if (queue.precedes(other, id))
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+
+		moveTask(id, low, moves);
+	}
+
+	/**
+	 * Retrieve the rank of a task in the current priority list.
+	 *
+	 * @param id - the task ID
+	 * @return the task's rank
+	 */
+	unsigned int rankOf(unsigned int id) const
+	{
+		return rank[id];
+	}
+
+	/**
+	 * Place a task at a rank of the current priority list without
+	 * shifting any other task (the caller places every task of a
+	 * permutation, e.g. every task of a recorded move list).
+	 *
+	 * @param id - the task ID
+	 * @param newRank - the task's new rank
+	 */
+	void placeTask(unsigned int id, unsigned int newRank)
+	{
+		order[newRank] = id;
+		rank[id] = newRank;
+	}
+
+	/**
+	 * Replace the current priority list, appending a move for every
+	 * task whose rank differs from the previous list.
+	 *
+	 * @param newOrder - the new descending priority list
+	 * @param moves - appended with every task whose rank changed
+	 */
+	void replaceOrder(const vector<unsigned int>& newOrder, vector<PriorityMove>& moves)
+	{
+		PriorityMove move;
+
+		order.resize(newOrder.size());
+		for (unsigned int i = 0; i < newOrder.size(); i++)
+		{
+			if (newOrder[i] >= rank.size())
+			{
+				rank.resize(newOrder[i] + 1, 0);
+			}
+			if (order[i] != newOrder[i])
+			{
+				order[i] = newOrder[i];
+				rank[order[i]] = i;
+				move.taskID = order[i];
+				move.rank = i;
+				moves.push_back(move);
+			}
+		}
+	}
+
+private:
+	// The current descending priority list and its inverse (task ID to rank)
+	vector<unsigned int> order;
+	vector<unsigned int> rank;
+
+	// Scratch list rebuilt by the default taskChanged()
+	vector<unsigned int> scratch;
+};
+
+#endif /* SCHEDULINGPOLICY_H_ */
@@ -0,0 +1,476 @@
+//*****************************************************************
+// Simulator.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "Simulator.h"
+#include "ProxyScheduler.h"
+#include "Platform.h"
+#include <algorithm>
+
+/**
+ * Default constructor for the simulator, which builds (but does not
+ * start) one task object for every compute/period pair.
+ *
+ * @param alg - the scheduling algorithm to simulate
+ * @param taskSet - the collection of task compute/period pairs
+ * @param runtime - the simulated test duration in seconds
+ * @param taskIDs - the (global) ID of each task, if the task set is one
+ *                  partition of a larger set (defaults to 0 to n-1)
+ * @param cpus - the number of CPUs the tasks are globally scheduled on
+ *               (the cpus highest priority released tasks run at once)
+ */
+Simulator::Simulator(AlgorithmType alg, vector<TaskData> taskSet, int runtime,
+		const vector<unsigned int>& taskIDs, unsigned int cpus)
+{
+	unsigned int taskID;
+
+	// Build the task objects (their threads are never started).
+	taskTable.reset(taskSet.size());
+	for (unsigned int i = 0; i < taskSet.size(); i++)
+	{
+		taskID = taskIDs.empty() ? i : taskIDs[i];
+		Task* task = new Task(taskID, taskSet[i].computeTime, taskSet[i].periodTime, &taskTable);
+		tasks.push_back(task);
+
+		if (taskID >= taskIndex.size())
+		{
+			taskIndex.resize(taskID + 1, NULL);
+			members.resize(taskID + 1, false);
+		}
+		taskIndex[taskID] = task;
+		members[taskID] = true;
+	}
+	released.assign(taskIndex.size(), false);
+	runningOn.assign(taskIndex.size(), -1);
+	lastCpu.assign(taskIndex.size(), -1);
+	runSequence.assign(taskIndex.size(), 0);
+
+	// Every CPU starts out idle
+	this->numCpus = (cpus > 0) ? cpus : 1;
+	running.assign(numCpus, -1);
+	runStart.assign(numCpus, 0);
+	selected.reserve(numCpus);
+
+	this->algorithmType = alg;
+	this->scheduler = SchedulingAlgorithm::create(alg);
+	this->runtime = runtime * NS_PER_SEC;
+	this->preemptions = 0;
+	this->migrations = 0;
+	this->realScheduleTime = 0;
+	this->numScheduleEvents = 0;
+}
+
+/**
+ * Default destructor that destroys every simulated task.
+ */
+Simulator::~Simulator()
+{
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		delete(*itr);
+	}
+	delete scheduler;
+}
+
+/**
+ * Run the simulated schedule test and log the collected data.
+ */
+void Simulator::run()
+{
+	uint64_t now = 0;
+	bool testComplete = false;
+	bool reschedule = false;
+	SimEvent event;
+
+	if (scheduler == NULL)
+	{
+		cerr << "Invalid scheduling algorithm selection. Terminating now." << endl;
+		return;
+	}
+
+	// Every task is released at time zero and its first deadline is one period later.
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		(*itr)->testRunning = true;
+		(*itr)->prepareJobs((unsigned int)(runtime / NS_PER_SEC));
+		(*itr)->startJobs(virtualCycles(now));
+		postEvent((*itr)->getPeriodTime() * NS_PER_MS, SIM_EVENT_DEADLINE, (*itr)->taskID());
+	}
+	postEvent(runtime, SIM_EVENT_END, 0);
+
+	// Determine the initial task schedules and start the first tasks.
+	cout << "START" << endl;
+	scheduler->reserve(tasks.size(), taskIndex.size());
+	moves.reserve(tasks.size());
+	scheduler->resetOrder(taskTable, moves);
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		released[(*itr)->taskID()] = true;
+	}
+	ranks.assign(taskIndex.size(), 0);
+	ready.reset(tasks.size());
+	applyMoves();
+	dispatch(now);
+
+	// Process events in time order until the test duration expires.
+	while (!testComplete && !events.empty())
+	{
+		now = events.top().time;
+		reschedule = false;
+
+		// Drain every event that occurs at this instant.
+		while (!events.empty() && events.top().time == now)
+		{
+			event = events.top();
+			events.pop();
+			Task* task = taskIndex[event.taskID];
+
+			switch (event.type)
+			{
+			case SIM_EVENT_COMPLETION:
+				// Ignore completions that were invalidated by a preemption.
+				if (runningOn[event.taskID] >= 0 && event.sequence == runSequence[event.taskID])
+				{
+					accountRunningTasks(now);
+					taskTable.setCurrentComputeTime(task->slot, 0);
+					taskTable.decrementBacklog(task->slot);
+					task->jobs.finish(virtualCycles(now));
+					taskTable.getStats(task->slot).totalComputationCycles++;
+					released[event.taskID] = task->pendingWork(); // backlog carries on
+					updateReady(event.taskID);
+					running[runningOn[event.taskID]] = -1;
+					runningOn[event.taskID] = -1;
+				}
+				break;
+			case SIM_EVENT_DEADLINE:
+				// Bring the running tasks up to date so missed time is exact.
+				accountRunningTasks(now);
+				task->jobs.release(virtualCycles(now));
+				if (task->expireDeadline())
+				{
+					scheduleTrace.record(EVENT_MISSED_DEADLINE, event.taskID, virtualCycles(now));
+				}
+				if (task->releaseCycleTime == Task::NO_RELEASE)
+				{
+					task->releaseCycleTime = virtualCycles(now);
+				}
+				postEvent(now, SIM_EVENT_RELEASE, event.taskID);
+				postEvent(now + (task->getPeriodTime() * NS_PER_MS), SIM_EVENT_DEADLINE, event.taskID);
+				break;
+			case SIM_EVENT_RELEASE:
+				scheduleEvent(event.taskID);
+				reschedule = true;
+				break;
+			case SIM_EVENT_END:
+			default:
+				testComplete = true;
+				break;
+			}
+		}
+
+		// A schedule event only preempts the running tasks that were displaced.
+		accountRunningTasks(now);
+		if (!testComplete && (reschedule || find(running.begin(), running.end(), -1) != running.end()))
+		{
+			dispatch(now);
+		}
+	}
+
+	cout << "STOP" << endl;
+	logData();
+}
+
+/**
+ * Push a new event onto the event queue.
+ *
+ * @param time - virtual time of the event in nanoseconds
+ * @param type - the event type
+ * @param taskID - the task the event applies to
+ */
+void Simulator::postEvent(uint64_t time, SimEventType type, unsigned int taskID)
+{
+	SimEvent event;
+	event.time = time;
+	event.type = type;
+	event.taskID = taskID;
+	event.sequence = (type == SIM_EVENT_COMPLETION) ? runSequence[taskID] : 0;
+	events.push(event);
+}
+
+/**
+ * Charge every running task for the compute time it has consumed
+ * since it was last dispatched.
+ *
+ * @param now - current virtual time in nanoseconds
+ */
+void Simulator::accountRunningTasks(uint64_t now)
+{
+	uint64_t elapsed;
+
+	for (unsigned int cpu = 0; cpu < numCpus; cpu++)
+	{
+		if (running[cpu] >= 0)
+		{
+			Task* task = taskIndex[running[cpu]];
+			elapsed = now - runStart[cpu];
+			TaskStats& stats = taskTable.getStats(task->slot);
+			taskTable.setCurrentComputeTime(task->slot, task->getCurrentComputeTime() + elapsed);
+			stats.totalComputationTime += elapsed;
+			stats.realComputeTime += (uint64_t)(((double)elapsed * Platform::cyclesPerSec()) / NS_PER_SEC);
+			runStart[cpu] = now;
+		}
+	}
+}
+
+/**
+ * Update the task priorities with the scheduling algorithm after a
+ * task's period expired and release that task.
+ *
+ * @param taskID - the task whose period expired
+ */
+void Simulator::scheduleEvent(unsigned int taskID)
+{
+	uint64_t startCycleTime = Platform::clockCycles();
+
+	// Only re-rank the task whose period expired (RMA ranks never change)
+	scheduler->taskChanged(taskTable, taskID, moves);
+	applyMoves();
+
+	// Release the task whose period expired (mirrors ProxyScheduler::runTest())
+	released[taskID] = true;
+	updateReady(taskID);
+
+	// Record the (real) time for this schedule event
+	uint64_t elapsed = Platform::clockCycles() - startCycleTime;
+	realScheduleTime += elapsed;
+	numScheduleEvents++;
+	scheduleLatency.record(elapsed);
+}
+
+/**
+ * Apply the priority moves reported by the scheduling algorithm to
+ * the rank index and the ready bitmap.
+ */
+void Simulator::applyMoves()
+{
+	// Every rank a task left is reported as the new rank of another task
+	for (vector<PriorityMove>::iterator itr = moves.begin(); itr != moves.end(); itr++)
+	{
+		ranks[itr->taskID] = itr->rank;
+		ready.assign(itr->rank, released[itr->taskID] && taskIndex[itr->taskID]->pendingWork());
+	}
+}
+
+/**
+ * Update the ready bit of a task's rank after it was released or
+ * completed a compute cycle.
+ *
+ * @param taskID - the task
+ */
+void Simulator::updateReady(unsigned int taskID)
+{
+	ready.assign(ranks[taskID], released[taskID] && taskIndex[taskID]->pendingWork());
+}
+
+/**
+ * Dispatch the highest priority released tasks (one per CPU), preempting
+ * every running task that is no longer among them.
+ *
+ * @param now - current virtual time in nanoseconds
+ */
+void Simulator::dispatch(uint64_t now)
+{
+	const vector<unsigned int>& priorities = scheduler->getOrder();
+	unsigned int cpu;
+	unsigned int level;
+	int id;
+
+	// Select the highest priority released tasks, one for each CPU,
+	// straight from the ready bitmap
+	selected.clear();
+	for (level = ready.first(); level != ReadyMap::NO_LEVEL && selected.size() < numCpus;
+			level = ready.next(level))
+	{
+		selected.push_back(priorities[level]);
+	}
+
+	// Preempt every running task that was displaced (its pending
+	// completion event is invalidated when it is dispatched again)
+	for (cpu = 0; cpu < numCpus; cpu++)
+	{
+		id = running[cpu];
+		if (id >= 0 && find(selected.begin(), selected.end(), (unsigned int)id) == selected.end())
+		{
+			runningOn[id] = -1;
+			running[cpu] = -1;
+			preemptions++;
+		}
+	}
+
+	// Start every selected task that is not running yet on an idle CPU,
+	// preferring the CPU it last ran on. Tasks that keep running stay put.
+	for (vector<unsigned int>::iterator itr = selected.begin(); itr != selected.end(); itr++)
+	{
+		Task* task = taskIndex[*itr];
+		if (runningOn[*itr] >= 0)
+		{
+			continue;
+		}
+
+		if (lastCpu[*itr] >= 0 && running[lastCpu[*itr]] < 0)
+		{
+			cpu = lastCpu[*itr];
+		}
+		else
+		{
+			cpu = find(running.begin(), running.end(), -1) - running.begin();
+			if (lastCpu[*itr] >= 0)
+			{
+				migrations++;
+			}
+		}
+
+		// Run the task until it completes (unless an event preempts it first).
+		running[cpu] = *itr;
+		runStart[cpu] = now;
+		runningOn[*itr] = cpu;
+		lastCpu[*itr] = cpu;
+		runSequence[*itr]++;
+		postEvent(now + task->remainingTime(), SIM_EVENT_COMPLETION, *itr);
+
+		// Log the schedule event
+		scheduleTrace.record(EVENT_SCHEDULE, *itr, virtualCycles(now));
+
+		// Log the (virtual) release-to-run latency when a new job starts
+		if (task->getCurrentComputeTime() == 0)
+		{
+			task->jobs.run(virtualCycles(now));
+			if (task->releaseCycleTime != Task::NO_RELEASE)
+			{
+				task->releaseLatency.record(virtualCycles(now) - task->releaseCycleTime);
+				task->releaseCycleTime = Task::NO_RELEASE;
+			}
+		}
+	}
+}
+
+/**
+ * Retrieve the number of deadlines missed by every task.
+ *
+ * @return missed deadline count
+ */
+unsigned int Simulator::getMissedDeadlines()
+{
+	unsigned int missed = 0;
+
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		missed += taskTable.getStats((*itr)->slot).deadlinesMissed;
+	}
+	return missed;
+}
+
+/**
+ * Retrieve the number of deadlines (period expiries) of every task.
+ *
+ * @return deadline event count
+ */
+unsigned int Simulator::getDeadlineEvents()
+{
+	unsigned int events = 0;
+
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		events += taskTable.getStats((*itr)->slot).deadlineEvents;
+	}
+	return events;
+}
+
+/**
+ * Retrieve the number of times a running task was displaced by a
+ * higher priority task.
+ *
+ * @return preemption count
+ */
+unsigned int Simulator::getPreemptions()
+{
+	return preemptions;
+}
+
+/**
+ * Retrieve the number of times a task resumed on a different CPU than
+ * the one it last ran on.
+ *
+ * @return migration count
+ */
+unsigned int Simulator::getMigrations()
+{
+	return migrations;
+}
+
+/**
+ * Convert a virtual time into the cycle counter units used by
+ * the schedule trace.
+ *
+ * @param now - virtual time in nanoseconds
+ * @return the equivalent number of cycles
+ */
+uint64_t Simulator::virtualCycles(uint64_t now)
+{
+	// Go through double to avoid overflowing long simulations.
+	return (uint64_t)(((double)now * (double)Platform::cyclesPerSec()) / (double)NS_PER_SEC);
+}
+
+/**
+ * Log all data collected during the simulation to stdout.
+ */
+void Simulator::logData()
+{
+	uint64_t cps;
+	float realSchedTime = 0;
+	float realTime = 0;
+	char data[256]; // arbitrary size big enough to fit what we need
+	string trace;
+
+	// Scheduling overhead is real (measured) time, the runtime is virtual
+	cps = Platform::cyclesPerSec();
+	realTime = (float)runtime / (float)NS_PER_SEC;
+	realSchedTime = ((float)((float)realScheduleTime / (float)cps));
+
+	// Log the schedule trace (of this simulation's tasks only)
+	scheduleTrace.formatSchedule(trace, members);
+	cout << "TRACE " << trace.c_str() << endl;
+	if (scheduleTrace.droppedRecords() > 0)
+	{
+		cerr << "Warning: " << scheduleTrace.droppedRecords() << " trace records dropped" << endl;
+	}
+
+	// Log the data (the virtual runtime has no error)
+	sprintf(data, "PDATA %f,%f,%f", realSchedTime / numScheduleEvents, realTime, 0.0f);
+	cout << data << endl;
+
+	// Log the latency distributions (count,p50,p99,p99.9,max in us); the
+	// release latencies are in virtual time
+	LatencyHistogram releaseLatency;
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		releaseLatency.add((*itr)->getReleaseLatency());
+	}
+	scheduleLatency.format(data, sizeof(data), "PHIST schedule", cps);
+	cout << data << endl;
+	releaseLatency.format(data, sizeof(data), "PHIST release", cps);
+	cout << data << endl;
+
+	// Log all task data
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		(*itr)->logData();
+	}
+}
@@ -0,0 +1,247 @@
+//*****************************************************************
+// Simulator.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef SIMULATOR_H_
+#define SIMULATOR_H_
+
+// Module includes
+#include "Project1.h"
+#include "Task.h"
+#include "SchedulingAlgorithm.h"
+#include "LatencyHistogram.h"
+#include "ReadyMap.h"
+#include <queue>
+
+/**
+ * This class is responsible for running a schedule test offline as a
+ * discrete-event simulation. It drives the same scheduling algorithms
+ * and task bookkeeping as the proxy scheduler, but against a virtual
+ * clock instead of real task threads and timers, so a test of any
+ * length completes as fast as its events can be processed. The output
+ * (TRACE/PDATA/TDATA) has the same format as a live test.
+ */
+class Simulator
+{
+public:
+	/**
+	 * Default constructor for the simulator, which builds (but does not
+	 * start) one task object for every compute/period pair.
+	 *
+	 * @param alg - the scheduling algorithm to simulate
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param runtime - the simulated test duration in seconds
+	 * @param taskIDs - the (global) ID of each task, if the task set is one
+	 *                  partition of a larger set (defaults to 0 to n-1)
+	 * @param cpus - the number of CPUs the tasks are globally scheduled on
+	 *               (the cpus highest priority released tasks run at once)
+	 */
+	Simulator(AlgorithmType alg, vector<TaskData> taskSet, int runtime,
+			const vector<unsigned int>& taskIDs = vector<unsigned int>(), unsigned int cpus = 1);
+
+	/**
+	 * Default destructor that destroys every simulated task.
+	 */
+	virtual ~Simulator();
+
+	/**
+	 * Run the simulated schedule test and log the collected data.
+	 */
+	void run();
+
+	/**
+	 * Retrieve the number of deadlines missed by every task.
+	 *
+	 * @return missed deadline count
+	 */
+	unsigned int getMissedDeadlines();
+
+	/**
+	 * Retrieve the number of deadlines (period expiries) of every task.
+	 *
+	 * @return deadline event count
+	 */
+	unsigned int getDeadlineEvents();
+
+	/**
+	 * Retrieve the number of times a running task was displaced by a
+	 * higher priority task.
+	 *
+	 * @return preemption count
+	 */
+	unsigned int getPreemptions();
+
+	/**
+	 * Retrieve the number of times a task resumed on a different CPU than
+	 * the one it last ran on.
+	 *
+	 * @return migration count
+	 */
+	unsigned int getMigrations();
+
+private:
+
+	// Enumeration of the simulation event types (in processing order
+	// for events that occur at the same instant)
+	typedef enum
+	{
+		SIM_EVENT_COMPLETION,
+		SIM_EVENT_DEADLINE,
+		SIM_EVENT_RELEASE,
+		SIM_EVENT_END
+	} SimEventType;
+
+	// A single entry in the simulation event queue
+	typedef struct
+	{
+		uint64_t time;
+		SimEventType type;
+		unsigned int taskID;
+		unsigned int sequence;
+	} SimEvent;
+
+	/**
+	 * Event queue ordering (earliest time first, then by event type).
+	 */
+	struct LaterEvent
+	{
+		bool operator()(const SimEvent& a, const SimEvent& b) const
+		{
+			if (a.time != b.time)
+			{
+				return a.time > b.time;
+			}
+			return a.type > b.type;
+		}
+	};
+
+	/**
+	 * Push a new event onto the event queue.
+	 *
+	 * @param time - virtual time of the event in nanoseconds
+	 * @param type - the event type
+	 * @param taskID - the task the event applies to
+	 */
+	void postEvent(uint64_t time, SimEventType type, unsigned int taskID);
+
+	/**
+	 * Charge every running task for the compute time it has consumed
+	 * since it was last dispatched.
+	 *
+	 * @param now - current virtual time in nanoseconds
+	 */
+	void accountRunningTasks(uint64_t now);
+
+	/**
+	 * Update the task priorities with the scheduling algorithm after a
+	 * task's period expired and release that task.
+	 *
+	 * @param taskID - the task whose period expired
+	 */
+	void scheduleEvent(unsigned int taskID);
+
+	/**
+	 * Apply the priority moves reported by the scheduling algorithm to
+	 * the rank index and the ready bitmap.
+	 */
+	void applyMoves();
+
+	/**
+	 * Update the ready bit of a task's rank after it was released or
+	 * completed a compute cycle.
+	 *
+	 * @param taskID - the task
+	 */
+	void updateReady(unsigned int taskID);
+
+	/**
+	 * Dispatch the highest priority released tasks (one per CPU), preempting
+	 * every running task that is no longer among them.
+	 *
+	 * @param now - current virtual time in nanoseconds
+	 */
+	void dispatch(uint64_t now);
+
+	/**
+	 * Convert a virtual time into the cycle counter units used by
+	 * the schedule trace.
+	 *
+	 * @param now - virtual time in nanoseconds
+	 * @return the equivalent number of cycles
+	 */
+	uint64_t virtualCycles(uint64_t now);
+
+	/**
+	 * Log all data collected during the simulation to stdout.
+	 */
+	void logData();
+
+	// Pending simulation events
+	priority_queue<SimEvent, vector<SimEvent>, LaterEvent> events;
+
+	// Simulated tasks, the same tasks indexed by task ID (NULL for the
+	// IDs of other partitions), their released (ready to run) flags and
+	// flags marking the IDs that belong to this simulation
+	vector<Task*> tasks;
+	vector<Task*> taskIndex;
+	vector<bool> released;
+	vector<bool> members;
+
+	// The scheduling keys and statistics of the simulated tasks
+	TaskTable taskTable;
+
+	// Priority moves reported by the scheduling algorithm
+	vector<PriorityMove> moves;
+
+	// The rank of every task (indexed by task ID) and the ranks of the
+	// tasks that are released with a compute cycle pending
+	vector<unsigned int> ranks;
+	ReadyMap ready;
+
+	// The scheduling algorithm being simulated
+	SchedulingAlgorithm* scheduler;
+	AlgorithmType algorithmType;
+
+	// Simulated test duration in nanoseconds
+	uint64_t runtime;
+
+	// Number of CPUs (running slots) shared by the tasks
+	unsigned int numCpus;
+
+	// The task running on each CPU (-1 when idle) and when it was dispatched
+	vector<int> running;
+	vector<uint64_t> runStart;
+
+	// Indexed by task ID: the CPU the task is running on (-1 if none), the
+	// CPU it last ran on (-1 if never) and the sequence number of its
+	// pending completion event
+	vector<int> runningOn;
+	vector<int> lastCpu;
+	vector<unsigned int> runSequence;
+
+	// Scratch list of the tasks selected to run by dispatch()
+	vector<unsigned int> selected;
+
+	// Number of preemptions and migrations
+	unsigned int preemptions;
+	unsigned int migrations;
+
+	// Total (real) schedule event time and number of events
+	uint64_t realScheduleTime;
+	uint64_t numScheduleEvents;
+
+	// Distribution of the (real) schedule event times
+	LatencyHistogram scheduleLatency;
+
+	// Some useful constants used for virtual timing
+	static const uint64_t NS_PER_MS = 1000000ULL;
+	static const uint64_t NS_PER_SEC = 1000000000ULL;
+};
+
+#endif /* SIMULATOR_H_ */
@@ -0,0 +1,234 @@
+//*****************************************************************
+// SpinQuantum.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "SpinQuantum.h"
+#include "Platform.h"
+#include "TaskTable.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+// Static member definitions (hand-tuned for a .1ms quantum until calibrated)
+long SpinQuantum::spin = 80000;
+long SpinQuantum::loopOverhead = 20000;
+double SpinQuantum::error = 0;
+
+// Private constants
+#define BATCHES          (5)   // measured batches per round
+#define BATCH_PASSES     (200) // compute loop passes per batch
+#define ADJUST_ROUNDS    (2)   // rounds that adjust the spin time
+#define NS_PER_SEC       (1000000000.0)
+#define PPM              (1000000.0)
+
+/**
+ * Calibrate the spin time of a quantum, or load it from the cache
+ * file if the cache holds an entry for this machine. A new calibration
+ * is added to the cache file. Platform::calibrate() must be called
+ * first.
+ *
+ * @param quantum - the compute time accounted for each spin (ns)
+ * @param cacheFile - the calibration cache file (NULL for no cache)
+ * @return true if the calibration was loaded from the cache
+ */
+bool SpinQuantum::calibrate(long quantum, const char* cacheFile)
+{
+	string key = cacheKey(quantum);
+	vector<double> passes;
+	double worst = 0;
+
+	if (cacheFile != NULL && load(cacheFile, key))
+	{
+		return true;
+	}
+
+	// Start by spinning the whole quantum, then take the loop overhead off
+	// the spin time (the median batch filters out interrupted batches).
+	spin = quantum;
+	for (int round = 0; round < ADJUST_ROUNDS; round++)
+	{
+		measure(quantum, spin, passes);
+		nth_element(passes.begin(), passes.begin() + (passes.size() / 2), passes.end());
+		loopOverhead = (long)(passes[passes.size() / 2] - spin);
+		spin = max(quantum - loopOverhead, 0L);
+	}
+
+	// Verify the final spin time
+	measure(quantum, spin, passes);
+	for (vector<double>::iterator itr = passes.begin(); itr != passes.end(); itr++)
+	{
+		worst = max(worst, (*itr > quantum) ? (*itr - quantum) : (quantum - *itr));
+	}
+	error = worst / quantum;
+
+	if (cacheFile != NULL)
+	{
+		save(cacheFile, key);
+	}
+	return false;
+}
+
+/**
+ * Retrieve the spin time to request for each quantum.
+ *
+ * @return spin time (ns)
+ */
+long SpinQuantum::spinTime()
+{
+	return spin;
+}
+
+/**
+ * Retrieve the loop overhead measured around each spin.
+ *
+ * @return loop overhead (ns)
+ */
+long SpinQuantum::overhead()
+{
+	return loopOverhead;
+}
+
+/**
+ * Retrieve the accuracy of the calibration: the worst relative error
+ * of the cost of one compute loop pass against the quantum.
+ *
+ * @return relative error (e.g. 0.01 for 1%)
+ */
+double SpinQuantum::accuracy()
+{
+	return error;
+}
+
+/**
+ * Measure the cost of one compute loop pass (the loop body of
+ * Task::startRoutine()) in batches of passes.
+ *
+ * @param quantum - the compute time accounted for each spin (ns)
+ * @param request - the spin time requested for each quantum (ns)
+ * @param passes - filled with the average cost of one pass in each batch (ns)
+ */
+void SpinQuantum::measure(long quantum, long request, vector<double>& passes)
+{
+	TaskTable table;
+	struct timespec burnTime;
+	uint64_t batchNs = (uint64_t)quantum * BATCH_PASSES;
+	uint64_t startCycleTime;
+	uint64_t endCycleTime;
+	uint64_t batchStart;
+	unsigned int slot;
+	int result;
+
+	table.reset(1);
+	slot = table.add(0, 1, 1);
+	TaskStats& stats = table.getStats(slot);
+	burnTime.tv_sec = 0;
+	burnTime.tv_nsec = request;
+
+	passes.clear();
+	for (int batch = 0; batch < BATCHES; batch++)
+	{
+		table.setCurrentComputeTime(slot, 0);
+		batchStart = Platform::clockCycles();
+		while (table.getCurrentComputeTime(slot) < batchNs)
+		{
+			startCycleTime = Platform::clockCycles();
+			result = Platform::spin(&burnTime);
+			endCycleTime = Platform::clockCycles();
+			stats.realComputeTime += (endCycleTime - startCycleTime);
+			if (result == 0)
+			{
+				table.setCurrentComputeTime(slot, table.getCurrentComputeTime(slot) + quantum);
+				stats.totalComputationTime += quantum;
+			}
+		}
+		endCycleTime = Platform::clockCycles();
+		passes.push_back(((endCycleTime - batchStart) * NS_PER_SEC) /
+				((double)Platform::cyclesPerSec() * BATCH_PASSES));
+	}
+}
+
+/**
+ * Build the cache key of this machine.
+ *
+ * @param quantum - the compute time accounted for each spin (ns)
+ * @return the key (cycle counter MHz, quantum and CPU model)
+ */
+string SpinQuantum::cacheKey(long quantum)
+{
+	ostringstream key;
+
+	key << ((Platform::cyclesPerSec() + 500000) / 1000000) << " " << quantum << " " << Platform::cpuModel();
+	return key.str();
+}
+
+/**
+ * Look up the calibration of this machine in the cache file.
+ *
+ * @param cacheFile - the calibration cache file
+ * @param key - the cache key of this machine
+ * @return true if an entry was found (and loaded)
+ */
+bool SpinQuantum::load(const char* cacheFile, const string& key)
+{
+	ifstream in(cacheFile);
+	string line;
+	string::size_type tab;
+	long errorPpm;
+
+	// Each line is "spin overhead errorPpm<tab>key"
+	while (getline(in, line))
+	{
+		tab = line.find('\t');
+		if (tab != string::npos && line.compare(tab + 1, string::npos, key) == 0 &&
+				sscanf(line.c_str(), "%ld %ld %ld", &spin, &loopOverhead, &errorPpm) == 3)
+		{
+			error = errorPpm / PPM;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Add (or replace) the calibration of this machine in the cache file.
+ *
+ * @param cacheFile - the calibration cache file
+ * @param key - the cache key of this machine
+ */
+void SpinQuantum::save(const char* cacheFile, const string& key)
+{
+	ifstream in(cacheFile);
+	vector<string> lines;
+	string line;
+	string::size_type tab;
+
+	// Keep the entries of every other machine
+	while (getline(in, line))
+	{
+		tab = line.find('\t');
+		if (tab != string::npos && line.compare(tab + 1, string::npos, key) != 0)
+		{
+			lines.push_back(line);
+		}
+	}
+	in.close();
+
+	ofstream out(cacheFile);
+	if (!out)
+	{
+		cerr << "Error writing calibration cache " << cacheFile << endl;
+		return;
+	}
+	for (vector<string>::iterator itr = lines.begin(); itr != lines.end(); itr++)
+	{
+		out << *itr << endl;
+	}
+	out << spin << " " << loopOverhead << " " << (long)(error * PPM) << "\t" << key << endl;
+}
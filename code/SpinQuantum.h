@@ -0,0 +1,112 @@
+//*****************************************************************
+// SpinQuantum.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef SPINQUANTUM_H_
+#define SPINQUANTUM_H_
+
+// Module includes
+#include "Project1.h"
+
+/**
+ * This class calibrates the spin time that a task requests from the
+ * spin primitive for each compute time quantum it accounts. One pass of
+ * a task's compute loop costs the spin itself plus the overhead around it
+ * (cycle counter reads, task table updates, the spin call), so the spin
+ * time is the quantum minus the measured loop overhead. The calibration
+ * runs the same loop body over a scratch task table, adjusts the spin time
+ * until one pass costs one quantum and then states the accuracy reached
+ * (the worst relative error of one pass over the verification batches).
+ *
+ * The result is cached in a text file keyed by the CPU model, the cycle
+ * counter rate (MHz) and the quantum, so later runs on the same machine
+ * skip the measurement.
+ *
+ * NOTE: ALL METHODS ARE STATIC
+ */
+class SpinQuantum
+{
+public:
+	/**
+	 * Calibrate the spin time of a quantum, or load it from the cache
+	 * file if the cache holds an entry for this machine. A new calibration
+	 * is added to the cache file. Platform::calibrate() must be called
+	 * first.
+	 *
+	 * @param quantum - the compute time accounted for each spin (ns)
+	 * @param cacheFile - the calibration cache file (NULL for no cache)
+	 * @return true if the calibration was loaded from the cache
+	 */
+	static bool calibrate(long quantum, const char* cacheFile);
+
+	/**
+	 * Retrieve the spin time to request for each quantum.
+	 *
+	 * @return spin time (ns)
+	 */
+	static long spinTime();
+
+	/**
+	 * Retrieve the loop overhead measured around each spin.
+	 *
+	 * @return loop overhead (ns)
+	 */
+	static long overhead();
+
+	/**
+	 * Retrieve the accuracy of the calibration: the worst relative error
+	 * of the cost of one compute loop pass against the quantum.
+	 *
+	 * @return relative error (e.g. 0.01 for 1%)
+	 */
+	static double accuracy();
+
+private:
+	/**
+	 * Measure the cost of one compute loop pass (the loop body of
+	 * Task::startRoutine()) in batches of passes.
+	 *
+	 * @param quantum - the compute time accounted for each spin (ns)
+	 * @param request - the spin time requested for each quantum (ns)
+	 * @param passes - filled with the average cost of one pass in each batch (ns)
+	 */
+	static void measure(long quantum, long request, vector<double>& passes);
+
+	/**
+	 * Build the cache key of this machine.
+	 *
+	 * @param quantum - the compute time accounted for each spin (ns)
+	 * @return the key (cycle counter MHz, quantum and CPU model)
+	 */
+	static string cacheKey(long quantum);
+
+	/**
+	 * Look up the calibration of this machine in the cache file.
+	 *
+	 * @param cacheFile - the calibration cache file
+	 * @param key - the cache key of this machine
+	 * @return true if an entry was found (and loaded)
+	 */
+	static bool load(const char* cacheFile, const string& key);
+
+	/**
+	 * Add (or replace) the calibration of this machine in the cache file.
+	 *
+	 * @param cacheFile - the calibration cache file
+	 * @param key - the cache key of this machine
+	 */
+	static void save(const char* cacheFile, const string& key);
+
+	// Calibrated spin time and loop overhead (ns) and accuracy
+	static long spin;
+	static long loopOverhead;
+	static double error;
+};
+
+#endif /* SPINQUANTUM_H_ */
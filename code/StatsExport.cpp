@@ -0,0 +1,233 @@
+//*****************************************************************
+// StatsExport.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "StatsExport.h"
+#include "Platform.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Static member definitions
+const uint32_t StatsExport::MAGIC;
+const unsigned int StatsExport::READ_ATTEMPTS;
+
+/**
+ * Default constructor for a detached region.
+ */
+StatsExport::StatsExport()
+{
+	header = NULL;
+	size = 0;
+	taskRecords = NULL;
+	schedulerRecords = NULL;
+}
+
+/**
+ * Default destructor that detaches from the region (and removes it if
+ * this object created it).
+ */
+StatsExport::~StatsExport()
+{
+	detach();
+}
+
+/**
+ * Create (or replace) the region of a schedule test.
+ *
+ * @param name - the shared-memory object name (e.g. "/project1")
+ * @param numTasks - the number of tasks (records are indexed by task ID)
+ * @param numSchedulers - the number of proxy schedulers
+ * @return true if the region was created
+ */
+bool StatsExport::create(const char* name, unsigned int numTasks, unsigned int numSchedulers)
+{
+	void* region;
+	int fd;
+
+	detach();
+	size = sizeof(StatsHeader) + (numTasks * sizeof(TaskStatsRecord)) +
+			(numSchedulers * sizeof(SchedulerStatsRecord));
+	fd = shm_open(name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+	if (fd < 0)
+	{
+		return false;
+	}
+	if (ftruncate(fd, size) != 0)
+	{
+		close(fd);
+		shm_unlink(name);
+		return false;
+	}
+	region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (region == MAP_FAILED)
+	{
+		shm_unlink(name);
+		return false;
+	}
+
+	// The region starts zeroed, so every record starts with an even sequence
+	header = (StatsHeader*)region;
+	header->numTasks = numTasks;
+	header->numSchedulers = numSchedulers;
+	header->cyclesPerSec = Platform::cyclesPerSec();
+	header->active = 1;
+	__sync_synchronize();
+	header->magic = MAGIC;
+	taskRecords = (TaskStatsRecord*)(header + 1);
+	schedulerRecords = (SchedulerStatsRecord*)(taskRecords + numTasks);
+	owned = name;
+
+	return true;
+}
+
+/**
+ * Attach to an existing region for reading.
+ *
+ * @param name - the shared-memory object name
+ * @return true if the region was attached
+ */
+bool StatsExport::attach(const char* name)
+{
+	struct stat info;
+	void* region;
+	int fd;
+
+	detach();
+	fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+	{
+		return false;
+	}
+	if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(StatsHeader))
+	{
+		close(fd);
+		return false;
+	}
+	region = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (region == MAP_FAILED)
+	{
+		return false;
+	}
+	header = (StatsHeader*)region;
+	size = info.st_size;
+
+	// Only accept a complete region that holds every record
+	if (header->magic != MAGIC || size < sizeof(StatsHeader) + (header->numTasks * sizeof(TaskStatsRecord)) +
+			(header->numSchedulers * sizeof(SchedulerStatsRecord)))
+	{
+		detach();
+		return false;
+	}
+	taskRecords = (TaskStatsRecord*)(header + 1);
+	schedulerRecords = (SchedulerStatsRecord*)(taskRecords + header->numTasks);
+
+	return true;
+}
+
+/**
+ * Detach from the region. The creator marks the test as over and
+ * removes the region.
+ */
+void StatsExport::detach()
+{
+	if (header == NULL)
+	{
+		return;
+	}
+	if (!owned.empty())
+	{
+		header->active = 0;
+		shm_unlink(owned.c_str());
+		owned.clear();
+	}
+	munmap(header, size);
+	header = NULL;
+	size = 0;
+	taskRecords = NULL;
+	schedulerRecords = NULL;
+}
+
+/**
+ * Copy a consistent snapshot of a task's record.
+ *
+ * @param id - the task's ID
+ * @param record - set to the snapshot
+ * @return false if the task does not exist or no consistent copy was made
+ */
+bool StatsExport::readTask(unsigned int id, TaskStatsRecord& record) const
+{
+	if (header == NULL || id >= header->numTasks)
+	{
+		return false;
+	}
+	return readRecord(taskRecords + id, &record, sizeof(record));
+}
+
+/**
+ * Copy a consistent snapshot of a proxy scheduler's record.
+ *
+ * @param index - the scheduler's index
+ * @param record - set to the snapshot
+ * @return false if the scheduler does not exist or no consistent copy was made
+ */
+bool StatsExport::readScheduler(unsigned int index, SchedulerStatsRecord& record) const
+{
+	if (header == NULL || index >= header->numSchedulers)
+	{
+		return false;
+	}
+	return readRecord(schedulerRecords + index, &record, sizeof(record));
+}
+
+/**
+ * Retrieve the region header (NULL if detached).
+ *
+ * @return the header
+ */
+const StatsHeader* StatsExport::getHeader() const
+{
+	return header;
+}
+
+/**
+ * Copy a consistent snapshot of a record with a sequence lock.
+ *
+ * @param source - the record in the region
+ * @param target - the snapshot
+ * @param size - the record size
+ * @return false if no consistent copy was made
+ */
+bool StatsExport::readRecord(const volatile void* source, void* target, size_t size)
+{
+	// Every record starts with its sequence
+	const volatile uint32_t* sequence = (const volatile uint32_t*)source;
+	uint32_t before;
+
+	for (unsigned int i = 0; i < READ_ATTEMPTS; i++)
+	{
+		before = *sequence;
+		if ((before & 1) != 0)
+		{
+			continue; // a write is in progress
+		}
+		__sync_synchronize();
+		memcpy(target, (const void*)source, size);
+		__sync_synchronize();
+		if (*sequence == before)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,199 @@
+//*****************************************************************
+// StatsExport.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef STATSEXPORT_H_
+#define STATSEXPORT_H_
+
+// Module includes
+#include "Project1.h"
+
+// Header of the shared-memory region (one cache line)
+typedef struct
+{
+	uint32_t magic;
+	uint32_t numTasks;
+	uint32_t numSchedulers;
+	volatile uint32_t active;  // 0 once the test is over
+	uint64_t cyclesPerSec;     // rate of the scheduler cycle counts
+	char padding[40];
+} StatsHeader;
+
+// Live statistics of one task (one cache line, indexed by task ID)
+typedef struct
+{
+	volatile uint32_t sequence; // odd while the record is being written
+	uint32_t deadlineEvents;
+	uint32_t deadlinesMissed;
+	uint32_t reserved;
+	uint64_t totalComputationTimeMissed; // ns
+	char padding[40];
+} TaskStatsRecord;
+
+// Live statistics of one proxy scheduler (one cache line)
+typedef struct
+{
+	volatile uint32_t sequence; // odd while the record is being written
+	uint32_t reserved;
+	uint64_t numScheduleEvents;
+	uint64_t realScheduleTime; // cycles
+	char padding[40];
+} SchedulerStatsRecord;
+
+/**
+ * This class publishes the live statistics of a schedule test (each
+ * task's deadline counters and each proxy scheduler's schedule event
+ * counters) in a POSIX shared-memory region, so a run can be watched
+ * from another process while it is in progress (see tools/StatsMonitor).
+ *
+ * Every record has a single writer (a task's records are written by its
+ * period event, a scheduler's by its schedule events) and is protected by
+ * a sequence lock: the writer makes the sequence odd, updates the record
+ * and makes the sequence even again, so writers never block or lock. A
+ * reader retries until it copies a record with the same even sequence
+ * before and after the copy.
+ */
+class StatsExport
+{
+public:
+	/**
+	 * Default constructor for a detached region.
+	 */
+	StatsExport();
+
+	/**
+	 * Default destructor that detaches from the region (and removes it if
+	 * this object created it).
+	 */
+	~StatsExport();
+
+	/**
+	 * Create (or replace) the region of a schedule test.
+	 *
+	 * @param name - the shared-memory object name (e.g. "/project1")
+	 * @param numTasks - the number of tasks (records are indexed by task ID)
+	 * @param numSchedulers - the number of proxy schedulers
+	 * @return true if the region was created
+	 */
+	bool create(const char* name, unsigned int numTasks, unsigned int numSchedulers);
+
+	/**
+	 * Attach to an existing region for reading.
+	 *
+	 * @param name - the shared-memory object name
+	 * @return true if the region was attached
+	 */
+	bool attach(const char* name);
+
+	/**
+	 * Detach from the region. The creator marks the test as over and
+	 * removes the region.
+	 */
+	void detach();
+
+	/**
+	 * Publish a task's deadline counters (never blocks).
+	 *
+	 * @param id - the task's ID
+	 * @param deadlineEvents - the number of deadlines that expired
+	 * @param deadlinesMissed - the number of deadlines missed
+	 * @param timeMissed - the compute time missed (ns)
+	 */
+	inline void publishTask(unsigned int id, uint32_t deadlineEvents, uint32_t deadlinesMissed, uint64_t timeMissed)
+	{
+		if (header == NULL || id >= header->numTasks)
+		{
+			return;
+		}
+		TaskStatsRecord* record = taskRecords + id;
+		record->sequence++;
+		__sync_synchronize();
+		record->deadlineEvents = deadlineEvents;
+		record->deadlinesMissed = deadlinesMissed;
+		record->totalComputationTimeMissed = timeMissed;
+		__sync_synchronize();
+		record->sequence++;
+	}
+
+	/**
+	 * Publish a proxy scheduler's schedule event counters (never blocks).
+	 *
+	 * @param index - the scheduler's index
+	 * @param numScheduleEvents - the number of schedule events
+	 * @param realScheduleTime - the total schedule event time (cycles)
+	 */
+	inline void publishScheduler(unsigned int index, uint64_t numScheduleEvents, uint64_t realScheduleTime)
+	{
+		if (header == NULL || index >= header->numSchedulers)
+		{
+			return;
+		}
+		SchedulerStatsRecord* record = schedulerRecords + index;
+		record->sequence++;
+		__sync_synchronize();
+		record->numScheduleEvents = numScheduleEvents;
+		record->realScheduleTime = realScheduleTime;
+		__sync_synchronize();
+		record->sequence++;
+	}
+
+	/**
+	 * Copy a consistent snapshot of a task's record.
+	 *
+	 * @param id - the task's ID
+	 * @param record - set to the snapshot
+	 * @return false if the task does not exist or no consistent copy was made
+	 */
+	bool readTask(unsigned int id, TaskStatsRecord& record) const;
+
+	/**
+	 * Copy a consistent snapshot of a proxy scheduler's record.
+	 *
+	 * @param index - the scheduler's index
+	 * @param record - set to the snapshot
+	 * @return false if the scheduler does not exist or no consistent copy was made
+	 */
+	bool readScheduler(unsigned int index, SchedulerStatsRecord& record) const;
+
+	/**
+	 * Retrieve the region header (NULL if detached).
+	 *
+	 * @return the header
+	 */
+	const StatsHeader* getHeader() const;
+
+private:
+	/**
+	 * Copy a consistent snapshot of a record with a sequence lock.
+	 *
+	 * @param source - the record in the region
+	 * @param target - the snapshot
+	 * @param size - the record size
+	 * @return false if no consistent copy was made
+	 */
+	static bool readRecord(const volatile void* source, void* target, size_t size);
+
+	// Mapped region, its size and name (the name is empty unless this
+	// object created the region)
+	StatsHeader* header;
+	size_t size;
+	string owned;
+
+	// The records that follow the header
+	TaskStatsRecord* taskRecords;
+	SchedulerStatsRecord* schedulerRecords;
+
+	// Magic number of a valid region
+	static const uint32_t MAGIC = 0x50315354; // "P1ST"
+
+	// Number of copies a reader attempts before giving up on a record
+	static const unsigned int READ_ATTEMPTS = 1000;
+};
+
+#endif /* STATSEXPORT_H_ */
@@ -11,18 +11,10 @@
 #include "Task.h"
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
 #include <unistd.h>
 #include "ProxyScheduler.h"
-
-/**
- * External (but friendly) function that is used as a callback
- * for each task's period timer. The single parameter stores
- * a pointer to the respective Task object whose period has
- * just expired.
- *
- * @param arg - sigval struct containing a pointer to a Task object
- */
-void taskTimerExpired(sigval arg);
+#include "SpinQuantum.h"
 
 /**
  * Default constructor for the task that stores its unique ID and
@@ -31,42 +23,34 @@ void taskTimerExpired(sigval arg);
  * @param id - the task's unique ID
  * @param computeTime - the tasks's compute time
  * @param periodTime - the tasks's period time
+ * @param table - the table that holds the task's scheduling keys
  */
-Task::Task(int id, int computeTime, int periodTime)
+Task::Task(int id, int computeTime, int periodTime, TaskTable* table)
 {
 	int result;
 
-	// Attempt to initialize the execution semaphore.
+	// Attempt to initialize the execution semaphores.
 	result = sem_init(&sem, 0, SEM_COUNT);
+	if (result == 0)
+	{
+		result = sem_init(&assignSem, 0, SEM_COUNT);
+	}
+	if (result == 0)
+	{
+		result = sem_init(&idleSem, 0, SEM_COUNT);
+	}
+
+	// Assign the task's first schedule test.
+	this->releasePosted = 0;
+	this->proxy = NULL;
+	this->statsExport = NULL;
+	assign(id, computeTime, periodTime, table);
 	if (result != 0)
 	{
 		cerr << "Error initializing execution semaphore for task " <<
 				id << endl;
 		uid = -1;
 	}
-	else
-	{
-		// Initialize the rest of the task's variables.
-		this->uid = id;
-		this->computeTime = computeTime;
-		this->currentComputeTime = 0;
-		this->periodTime = periodTime;
-		this->deadline = periodTime;
-		this->deadlinesMissed = 0;
-		this->deadlineEvents = 0;
-		this->totalComputationTimeMissed = 0;
-		this->totalComputationTime = 0;
-		this->totalComputationCycles = 0;
-		this->averageTaskPeriod = 0;
-		this->realComputeTime = 0;
-		this->computeTransitionTime = 0;
-
-		// Initialize the burn time quantum.
-		this->burnTime.tv_nsec = REAL_TIME_QUANTUM;
-
-		// Configure the period timer.
-		configureTimer();
-	}
 }
 
 /**
@@ -88,134 +72,223 @@ void* Task::startRoutine()
 	uint64_t startCycleTime = 0;
 	uint64_t endCycleTime = 0;
 	uint64_t postEndCycleTime = 0;
+	unsigned int computeNs;
+	bool firstRun;
 
-	// Set up some flags used to control task execution
-	bool firstRun = true;
-	computeComplete = 1;
-	testRunning = true;
-	preempted = false;
-	firstTimerRun = true;
-
-	// Reset the current compute time for this test
-	currentComputeTime = 0;
-
-	// Wait until we are released (a test begins)
-	sem_wait(&sem);
-
-	// Create the timer and kick it off
-	timer_create(CLOCK_REALTIME, &event, &timerID);
-	timer_settime(timerID, 0, &timerSpec, NULL);
-	sem_post(&proxySem);
-
-	// Intermittent wait that is used to make sure every task's timer is started
-	sem_wait(&sem);
+	// Count the thread's events (kept open from one pooled test to the next)
+	counters.open();
 
-	// Jump into the test loop where the task will iteratively execute
-	// compute cycles when it is scheduled
-	while (testRunning)
+	// Run one schedule test after another until the task is stopped
+	while (true)
 	{
-		// Block on execution semaphore (only after the first cycle)
-		if (!firstRun)
+		// Wait for the next schedule test (or for the task to be stopped)
+		sem_wait(&assignSem);
+		if (!alive)
 		{
-			sem_wait(&sem);
-			preempted = false;
-		}
-		else
-		{
-			firstRun = false;
+			break;
 		}
 
-		// Log pre-compute cycles
-		preEndCycleTime = 0;
-		preStartCycleTime = ClockCycles();
+		// Set up some flags used to control task execution (assign() has
+		// already reset the task's compute cycle for this test)
+		TaskStats& stats = table->getStats(slot);
+		computeNs = table->getComputeTime(slot) * NS_PER_MS;
+		firstRun = true;
+
+		// Wait until we are released (a test begins)
+		waitRelease();
+
+		// Let the proxy scheduler know we are ready
+		proxy->taskReady();
 
-		// Log the schedule event
-		TraceEvent(_NTO_TRACE_INSERTSUSEREVENT, EVENT_SCHEDULE, EVENT_SCHEDULE, uid);
-		scheduleList.push_back(uid);
+		// Intermittent wait that is used to make sure every task is ready
+		// before the proxy scheduler arms the period timers
+		waitRelease();
+		counters.start();
 
-		// Begin/resume the compute cycle.
-		while (currentComputeTime < (computeTime * NS_PER_MS))
+		// Jump into the test loop where the task will iteratively execute
+		// compute cycles when it is scheduled
+		while (testRunning)
 		{
-			if (!preempted)
+			// Block on execution semaphore (only after the first cycle)
+			if (!firstRun)
 			{
-				// Record start compute time jitter
-				if (preEndCycleTime == 0)
+				waitRelease();
+				preempted = false;
+
+				// A release can race with the completion of the job it was
+				// meant for; go back to sleep if no cycle is pending.
+				if (table->getBacklog(slot) <= 0)
 				{
-					preEndCycleTime = ClockCycles();
+					continue;
 				}
+			}
+			else
+			{
+				firstRun = false;
+			}
 
-				// Burn and churn.
-				startCycleTime = ClockCycles();
-				result = nanospin(&burnTime);
-				endCycleTime = ClockCycles();
+			// Log pre-compute cycles
+			preEndCycleTime = 0;
+			preStartCycleTime = Platform::clockCycles();
 
-				// Preemption means that nanospin took longer than expected, so handle that case.
-				if (!preempted)
-				{
-					realComputeTime += (endCycleTime - startCycleTime);
-				}
-				else
+			// Log the schedule event
+			Platform::traceEvent(EVENT_SCHEDULE, uid);
+			scheduleTrace.record(EVENT_SCHEDULE, uid, preStartCycleTime);
+
+			// Log the release-to-run latency when a new job starts
+			if (table->getCurrentComputeTime(slot) == 0)
+			{
+				jobs.run(preStartCycleTime);
+				if (releaseCycleTime != NO_RELEASE)
 				{
-					realComputeTime += TIME_QUANTUM; // unavoidable
+					releaseLatency.record(preStartCycleTime - releaseCycleTime);
+					releaseCycleTime = NO_RELEASE;
 				}
+			}
 
-				// Check the nanospin return, just to be safe.
-				if (result == 0)
+			// Begin/resume the compute cycle.
+			while (table->getCurrentComputeTime(slot) < computeNs)
+			{
+				if (!preempted)
 				{
-					// We're okay - bump up the compute time.
-					currentComputeTime += TIME_QUANTUM;
-					totalComputationTime += TIME_QUANTUM;
+					// Record start compute time jitter
+					if (preEndCycleTime == 0)
+					{
+						preEndCycleTime = Platform::clockCycles();
+					}
+
+					// Burn and churn.
+					startCycleTime = Platform::clockCycles();
+					result = Platform::spin(&burnTime);
+					endCycleTime = Platform::clockCycles();
+
+					// Preemption means that the spin took longer than expected, so handle that case.
+					if (!preempted)
+					{
+						stats.realComputeTime += (endCycleTime - startCycleTime);
+					}
+					else
+					{
+						stats.realComputeTime += TIME_QUANTUM; // unavoidable
+					}
+
+					// Check the spin return, just to be safe.
+					if (result == 0)
+					{
+						// We're okay - bump up the compute time.
+						table->setCurrentComputeTime(slot, table->getCurrentComputeTime(slot) + TIME_QUANTUM);
+						stats.totalComputationTime += TIME_QUANTUM;
+					}
+					else
+					{
+						cout << "Error: Task " << uid << " spin returned: " << result << endl;
+					}
 				}
 				else
 				{
-					cout << "Error: Task " << uid << " nanospin() returned: " << result << endl;
+					break; // Drop back to the execution semaphore.
 				}
 			}
-			else
+
+			// Check for deadline being hit
+			if (table->getCurrentComputeTime(slot) >= computeNs)
 			{
-				break; // Drop back to the execution semaphore.
+				// Update the new deadline and reset the compute time
+				table->setCurrentComputeTime(slot, 0);
+				table->decrementBacklog(slot);
+				stats.totalComputationCycles++;
+				jobs.finish(endCycleTime);
+
+				// Carry straight on if another compute cycle is already pending
+				// (the proxy scheduler only releases tasks whose state changed).
+				release();
+				proxy->postTaskCompletion(uid);
 			}
-		}
 
-		// Check for deadline being hit
-		if (currentComputeTime >= (computeTime * NS_PER_MS))
-		{
-			// Update the new deadline and reset the compute time
-			currentComputeTime = 0;
-			computeComplete--;
-			totalComputationCycles++;
-		}
+			// Log post compute time cycles
+			postEndCycleTime = Platform::clockCycles();
+			stats.computeTransitionTime += ((postEndCycleTime - endCycleTime) +
+					(preEndCycleTime - preStartCycleTime));
 
-		// Log post compute time cycles
-		postEndCycleTime = ClockCycles();
-		computeTransitionTime += ((postEndCycleTime - endCycleTime) +
-				(preEndCycleTime - preStartCycleTime));
+			// Give up the CPU for other tasks to execute
+			sched_yield();
+		}
 
-		// Give up the CPU for other tasks to execute
-		sched_yield();
+		// Let the task pool know the thread has left this test
+		sem_post(&idleSem);
 	}
 
 	// Suicide
 	kill();
+}
 
-	// Delete the timer for the period - no longer needed
-	timer_delete(timerID);
+/**
+ * Re-parameterize the task for a new schedule test, so a pooled task
+ * thread can run test after test (the task must be idle, see
+ * waitIdle()). The constructor assigns the task's first test.
+ *
+ * @param id - the task's unique ID
+ * @param computeTime - the tasks's compute time
+ * @param periodTime - the tasks's period time
+ * @param table - the table that holds the task's scheduling keys
+ */
+void Task::assign(int id, int computeTime, int periodTime, TaskTable* table)
+{
+	// Register the task's scheduling keys (the table is sized for every task,
+	// and its first compute cycle is pending).
+	this->table = table;
+	this->slot = table->add(id, computeTime, periodTime);
+	assert(slot != TaskTable::NO_SLOT);
+
+	// Initialize the rest of the task's variables.
+	this->uid = id;
+	this->releaseCycleTime = NO_RELEASE;
+	this->releaseLatency.reset();
+	this->testRunning = true;
+	this->preempted = false;
+
+	// Initialize the burn time quantum (calibrated to the loop overhead).
+	this->burnTime.tv_sec = 0;
+	this->burnTime.tv_nsec = SpinQuantum::spinTime();
+
+	// Drop any release left over from the previous test, then hand
+	// this test to the task thread.
+	while (sem_trywait(&sem) == 0)
+	{
+	}
+	__sync_lock_release(&releasePosted);
+	sem_post(&assignSem);
 }
 
 /**
- * Configure the task's timer to fire an event at every periodic
- * interval that corresponds to the task's period.
+ * Block until the task thread has left its current schedule test
+ * (after stopTest()) and waits for its next assignment.
  */
-void Task::configureTimer()
+void Task::waitIdle()
 {
-	// Initialize the timer thread to invoke a function when it expires
-	SIGEV_THREAD_INIT(&event, &taskTimerExpired, this, 0);
-	
-	// Configure the timer parameters (period signals only)
-	timerSpec.it_value.tv_sec = 0;
-	timerSpec.it_value.tv_nsec = 1;
-	timerSpec.it_interval.tv_sec = 0;
-	timerSpec.it_interval.tv_nsec = periodTime * NS_PER_MS;
+	sem_wait(&idleSem);
+}
+
+/**
+ * Set the proxy scheduler that schedules this task (must be called
+ * before start()).
+ *
+ * @param proxy - the proxy scheduler
+ */
+void Task::setProxy(ProxyScheduler* proxy)
+{
+	this->proxy = proxy;
+}
+
+/**
+ * Set the region the task's live statistics are published in (must be
+ * called before each test starts).
+ *
+ * @param stats - the region, or NULL to publish nothing
+ */
+void Task::setStatsExport(StatsExport* stats)
+{
+	this->statsExport = stats;
 }
 
 /**
@@ -225,7 +298,7 @@ void Task::configureTimer()
  */
 unsigned int Task::getPeriodTime()
 {
-	return periodTime;
+	return table->getPeriodTime(slot);
 }
 
 /**
@@ -235,7 +308,7 @@ unsigned int Task::getPeriodTime()
  */
 unsigned int Task::getComputeTime()
 {
-	return computeTime;
+	return table->getComputeTime(slot);
 }
 
 /**
@@ -245,7 +318,7 @@ unsigned int Task::getComputeTime()
  */
 unsigned int Task::getDeadline()
 {
-	return deadline;
+	return table->getDeadline(slot);
 }
 
 /**
@@ -256,7 +329,7 @@ unsigned int Task::getDeadline()
  */
 unsigned int Task::getCurrentComputeTime()
 {
-	return currentComputeTime;
+	return table->getCurrentComputeTime(slot);
 }
 
 /**
@@ -266,31 +339,65 @@ unsigned int Task::getCurrentComputeTime()
  */
 void Task::periodEvent()
 {
+	uint64_t releaseTime;
+
 	if (testRunning)
 	{
-		deadlineEvents++;
-
-		// Check for missed deadline
-		if (computeComplete > 0)
+		releaseTime = Platform::clockCycles();
+		jobs.release(releaseTime);
+		if (expireDeadline())
 		{
-			deadlinesMissed++;
-			totalComputationTimeMissed += ((computeTime * NS_PER_MS) - currentComputeTime);
-
-			// Log this event
-			TraceEvent(_NTO_TRACE_INSERTSUSEREVENT, EVENT_MISSED_DEADLINE, EVENT_MISSED_DEADLINE, uid);
-			cout << "MISSED " << uid << endl;
+			scheduleTrace.record(EVENT_MISSED_DEADLINE, uid, releaseTime);
+		}
+		if (statsExport != NULL)
+		{
+			TaskStats& stats = table->getStats(slot);
+			statsExport->publishTask(uid, stats.deadlineEvents, stats.deadlinesMissed,
+					stats.totalComputationTimeMissed);
+		}
+		if (releaseCycleTime == NO_RELEASE)
+		{
+			releaseCycleTime = releaseTime;
 		}
-
-		// Reset the deadline information
-		deadline += periodTime;
-		computeComplete++; // add on another compute cycle
 
 		// Let the scheduler know our period has expired
-		sem_post(&proxySem);
+		proxy->postTaskEvent(uid);
 		sched_yield();
 	}
 }
 
+/**
+ * Check whether the compute cycle for the period that just expired
+ * was completed, record a missed deadline if it was not, and then
+ * advance the deadline to the end of the next period.
+ *
+ * @return true if the deadline was missed
+ */
+bool Task::expireDeadline()
+{
+	bool missed = (table->getBacklog(slot) > 0);
+	TaskStats& stats = table->getStats(slot);
+
+	stats.deadlineEvents++;
+
+	// Check for missed deadline
+	if (missed)
+	{
+		stats.deadlinesMissed++;
+		stats.totalComputationTimeMissed += table->getRemainingTime(slot);
+
+		// Log this event
+		Platform::traceEvent(EVENT_MISSED_DEADLINE, uid);
+		cout << "MISSED " << uid << endl;
+	}
+
+	// Reset the deadline information
+	table->setDeadline(slot, table->getDeadline(slot) + table->getPeriodTime(slot));
+	table->incrementBacklog(slot); // add on another compute cycle
+
+	return missed;
+}
+
 /**
  * Retrieve the amount of time remaining in this
  * task's current compute cycle.
@@ -299,7 +406,7 @@ void Task::periodEvent()
  */
 unsigned int Task::remainingTime()
 {
-	return ((computeTime * NS_PER_MS) - currentComputeTime);
+	return table->getRemainingTime(slot);
 }
 
 /**
@@ -318,13 +425,72 @@ struct sched_param* Task::getSchedParam()
  */
 void Task::release()
 {
-	// Only release from the semaphore if we are still in a compute cycle.
-	if (computeComplete != 0)
+	// Only release from the semaphore if a compute cycle is pending, and
+	// never post twice (the semaphore is treated as binary). The flag is
+	// claimed atomically since the proxy and task threads both release.
+	if (table->getBacklog(slot) > 0 &&
+			__sync_bool_compare_and_swap(&releasePosted, 0, 1))
 	{
 		sem_post(&sem);
 	}
 }
 
+/**
+ * Block on the execution semaphore until the task is released, then allow
+ * the next release to post it again.
+ */
+void Task::waitRelease()
+{
+	sem_wait(&sem);
+	__sync_lock_release(&releasePosted);
+}
+
+/**
+ * Determine whether this task has a compute cycle pending.
+ *
+ * @return true if the current (or a backlogged) compute cycle is incomplete
+ */
+bool Task::pendingWork()
+{
+	return (table->getBacklog(slot) > 0);
+}
+
+/**
+ * Retrieve the histogram of this task's release-to-run latencies.
+ *
+ * @return the latency histogram (in clock cycles)
+ */
+const LatencyHistogram& Task::getReleaseLatency()
+{
+	return releaseLatency;
+}
+
+/**
+ * Allocate the storage of the release, start and finish time of every
+ * job of a schedule test (before the test starts).
+ *
+ * @param runtime - the test runtime (s)
+ */
+void Task::prepareJobs(unsigned int runtime)
+{
+	uint64_t periodTime = table->getPeriodTime(slot);
+	uint64_t capacity = (((uint64_t)runtime * 1000) / periodTime) + 2; // a partial period at each end
+
+	jobs.reset((unsigned int)min(capacity, (uint64_t)MAX_JOBS), ((double)periodTime * Platform::cyclesPerSec()) / 1000.0);
+}
+
+/**
+ * Record the start of the schedule test (the release of the first job,
+ * before the period timers are armed).
+ *
+ * @param cycles - the time the test started
+ */
+void Task::startJobs(uint64_t cycles)
+{
+	jobs.start(cycles);
+	releaseCycleTime = cycles;
+}
+
 /**
  * Pause (preempt) this task during its computation cycle and make it
  * block on its execution semaphore.
@@ -350,6 +516,7 @@ void Task::stopTask()
 {
 	alive = false;
 	sem_post(&sem);
+	sem_post(&assignSem);
 }
 
 /**
@@ -362,40 +529,43 @@ void Task::logData()
 	float realTime = 0;
 	float realTransitionTime = 0;
 	char data[256];
+	char label[32];
+	TaskStats& stats = table->getStats(slot);
 
 	// Determine the clock rate
-	cps = SYSPAGE_ENTRY(qtime)->cycles_per_sec;
+	cps = Platform::cyclesPerSec();
 
 	// Calculate the real compute time period
-	realTime = ((float)((float)realComputeTime / (float)cps) * 1000);
-	realTransitionTime = (float)((float)computeTransitionTime / (float)cps) * 1000;
+	realTime = ((float)((float)stats.realComputeTime / (float)cps) * 1000);
+	realTransitionTime = (float)((float)stats.computeTransitionTime / (float)cps) * 1000;
 
 	// Log the data
-	sprintf(data, "TDATA %d,%d,%d,%d,%d,%d,%f,%f,%f", uid, deadlineEvents,
-			deadlinesMissed, totalComputationTimeMissed, totalComputationTime / NS_PER_MS,
-			totalComputationCycles, realTransitionTime / realTime, realTime,
-			((totalComputationTime / NS_PER_MS) - realTime) / (totalComputationTime / NS_PER_MS));
-	TraceEvent(_NTO_TRACE_INSERTUSRSTREVENT, EVENT_PROXY_DATA, data);
+	sprintf(data, "TDATA %u,%u,%u,%lu,%lu,%u,%f,%f,%f", uid, stats.deadlineEvents,
+			stats.deadlinesMissed, stats.totalComputationTimeMissed, stats.totalComputationTime / NS_PER_MS,
+			stats.totalComputationCycles, realTransitionTime / realTime, realTime,
+			((stats.totalComputationTime / NS_PER_MS) - realTime) / (stats.totalComputationTime / NS_PER_MS));
+	counters.format(data, sizeof(data));
+	Platform::traceString(EVENT_PROXY_DATA, data);
+	cout << data << endl;
+
+	// Log the response time and release jitter distributions
+	// (released,finished,min,p50,p99,max of each in us)
+	sprintf(label, "JDATA %u", uid);
+	jobs.format(data, sizeof(data), label, cps);
+	Platform::traceString(EVENT_PROXY_DATA, data);
 	cout << data << endl;
 }
 
 /**
- * External (but friendly) function that is used as a callback
+ * External (but friendly) function that is used as the callback
  * for each task's period timer. The single parameter stores
  * a pointer to the respective Task object whose period has
  * just expired.
  *
- * @param arg - sigval struct containing a pointer to a Task object
+ * @param arg - pointer to a Task object
  */
-void taskTimerExpired(sigval arg)
+void taskTimerExpired(void* arg)
 {
-	Task* task = (Task*)arg.sival_ptr;
-	if (!task->firstTimerRun)
-	{
-		task->periodEvent();
-	}
-	else
-	{
-		task->firstTimerRun = false;
-	}
+	Task* task = (Task*)arg;
+	task->periodEvent();
 }
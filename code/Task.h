@@ -14,10 +14,27 @@
 // Module includes
 #include "Thread.h"
 #include "Project1.h"
+#include "Platform.h"
+#include "LatencyHistogram.h"
+#include "TaskTable.h"
+#include "PerfCounters.h"
+#include "StatsExport.h"
+#include "JobLog.h"
 #include <pthread.h>
 
 // Forward declaration due to bidirectional association
 class ProxyScheduler;
+class Simulator;
+
+/**
+ * External (but friendly) function that is used as the callback
+ * for each task's period timer. The single parameter stores
+ * a pointer to the respective Task object whose period has
+ * just expired.
+ *
+ * @param arg - pointer to a Task object
+ */
+void taskTimerExpired(void* arg);
 
 /**
  * This class is responsible for managing the execution logic for a task
@@ -26,6 +43,9 @@ class ProxyScheduler;
  */
 class Task : public Thread
 {
+	// The simulator drives the task's compute cycle in virtual time
+	friend class Simulator;
+
 public:
 	/**
 	 * Default constructor for the task that stores its unique ID and
@@ -34,14 +54,49 @@ public:
 	 * @param id - the task's unique ID
 	 * @param computeTime - the tasks's compute time
 	 * @param periodTime - the tasks's period time
+	 * @param table - the table that holds the task's scheduling keys
 	 */
-	Task(int id, int computeTime, int periodTime);
+	Task(int id, int computeTime, int periodTime, TaskTable* table);
 
 	/**
 	 * Default destructor for the task (no tear-down required).
 	 */
 	virtual ~Task();
 
+	/**
+	 * Re-parameterize the task for a new schedule test, so a pooled task
+	 * thread can run test after test (the task must be idle, see
+	 * waitIdle()). The constructor assigns the task's first test.
+	 *
+	 * @param id - the task's unique ID
+	 * @param computeTime - the tasks's compute time
+	 * @param periodTime - the tasks's period time
+	 * @param table - the table that holds the task's scheduling keys
+	 */
+	void assign(int id, int computeTime, int periodTime, TaskTable* table);
+
+	/**
+	 * Block until the task thread has left its current schedule test
+	 * (after stopTest()) and waits for its next assignment.
+	 */
+	void waitIdle();
+
+	/**
+	 * Set the proxy scheduler that schedules this task (must be called
+	 * before start()).
+	 *
+	 * @param proxy - the proxy scheduler
+	 */
+	void setProxy(ProxyScheduler* proxy);
+
+	/**
+	 * Set the region the task's live statistics are published in (must be
+	 * called before each test starts).
+	 *
+	 * @param stats - the region, or NULL to publish nothing
+	 */
+	void setStatsExport(StatsExport* stats);
+
 	/**
 	 * Retrieve this task's period time.
 	 *
@@ -99,6 +154,36 @@ public:
 	 */
 	void release();
 
+	/**
+	 * Determine whether this task has a compute cycle pending.
+	 *
+	 * @return true if the current (or a backlogged) compute cycle is incomplete
+	 */
+	bool pendingWork();
+
+	/**
+	 * Retrieve the histogram of this task's release-to-run latencies.
+	 *
+	 * @return the latency histogram (in clock cycles)
+	 */
+	const LatencyHistogram& getReleaseLatency();
+
+	/**
+	 * Allocate the storage of the release, start and finish time of every
+	 * job of a schedule test (before the test starts).
+	 *
+	 * @param runtime - the test runtime (s)
+	 */
+	void prepareJobs(unsigned int runtime);
+
+	/**
+	 * Record the start of the schedule test (the release of the first job,
+	 * before the period timers are armed).
+	 *
+	 * @param cycles - the time the test started
+	 */
+	void startJobs(uint64_t cycles);
+
 	/**
 	 * Pause (preempt) this task during its computation cycle and make it
 	 * block on its execution semaphore.
@@ -121,8 +206,10 @@ public:
 	 */
 	void logData();
 
-	// Boolean primer for the timer
-	volatile bool firstTimerRun;
+	// The compute time accounted for each spin (.1ms); the spin time that
+	// makes one compute loop pass cost a quantum is calibrated at startup
+	// (see SpinQuantum)
+	static const long TIME_QUANTUM = 100000;
 
 protected:
 
@@ -133,57 +220,72 @@ protected:
 
 private:
 
-	// Structures used by the underlying task timer thread
-	struct itimerspec timerSpec;
-	struct sigevent event;
-
-	// The ID of this task's period timer
-	timer_t timerID;
-
 	// The task's execution semaphore (controlled by the proxy scheduler)
 	sem_t sem;
 
+	// Nonzero while a release is posted on the execution semaphore and
+	// the task thread has not yet woken up from it
+	volatile int releasePosted;
+
+	// Semaphores that hand each schedule test to the task thread and
+	// signal that the thread has left it
+	sem_t assignSem;
+	sem_t idleSem;
+
+	// The proxy scheduler that is notified of this task's events
+	ProxyScheduler* proxy;
+
 	// Boolean flag indicating whether or not the task has been preempted.
 	volatile bool preempted;
 
 	// Boolean flag indicating whether or not a test is still being conducted.
 	volatile bool testRunning;
 
-	// Task compute and period time values.
-	unsigned int computeTime;
-	unsigned int periodTime;
-	unsigned int currentComputeTime;
-	unsigned int deadline;
+	// The table that holds the task's compute/period time values, current
+	// deadline and compute time, the number of compute cycles it has left
+	// to complete and its runtime statistics, and the task's slot.
+	TaskTable* table;
+	unsigned int slot;
 
 	// The time quantum struct used to burn CPU cycles.
 	struct timespec burnTime;
 
-	// Counter indicating how many compute cycles this task has left to complete
-	volatile int computeComplete;
+	// Release time of the oldest job that has not started yet (NO_RELEASE if
+	// none), and the latencies from each job's release until it first runs
+	volatile uint64_t releaseCycleTime;
+	LatencyHistogram releaseLatency;
 
-	// Schedule data that is collected at runtime
-	unsigned int deadlineEvents;
-	unsigned int deadlinesMissed;
-	unsigned long totalComputationTimeMissed;
-	unsigned long totalComputationTime;
-	unsigned int totalComputationCycles;
-	unsigned int averageTaskPeriod;
-	uint64_t realComputeTime;
-	uint64_t computeTransitionTime;
+	// Release, start and finish time of every job of the test
+	JobLog jobs;
+
+	// The task thread's performance counters (if enabled)
+	PerfCounters counters;
+
+	// The region the task's live statistics are published in (NULL if none)
+	StatsExport* statsExport;
 
 	// The task's schedule parameter structure
 	struct sched_param schedParam;
 
 	// Constants used during the task lifetime
 	static const int SEM_COUNT = 0; // binary semaphore initial value
-	static const long TIME_QUANTUM = 100000; // .1ms time quantum (needs to be calibrated)
-	static const long REAL_TIME_QUANTUM = 80000; // adjusted time quantum
+	static const unsigned int MAX_JOBS = 1 << 20; // most jobs recorded per test
+	static const uint64_t NO_RELEASE = ~(uint64_t)0; // no job waiting to start
+
+	/**
+	 * Check whether the compute cycle for the period that just expired
+	 * was completed, record a missed deadline if it was not, and then
+	 * advance the deadline to the end of the next period.
+	 *
+	 * @return true if the deadline was missed
+	 */
+	bool expireDeadline();
 
 	/**
-	 * Configure the task's timer to fire an event at every periodic
-	 * interval that corresponds to the task's period.
+	 * Block on the execution semaphore until the task is released, then allow
+	 * the next release to post it again.
 	 */
-	void configureTimer();
+	void waitRelease();
 };
 
 #endif /* TASK_H_ */
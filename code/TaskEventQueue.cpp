@@ -0,0 +1,99 @@
+//*****************************************************************
+// TaskEventQueue.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TaskEventQueue.h"
+
+/**
+ * Default constructor for an empty (zero capacity) queue.
+ */
+TaskEventQueue::TaskEventQueue()
+{
+	cells = NULL;
+	reset(1);
+}
+
+/**
+ * Default destructor that frees the queue storage.
+ */
+TaskEventQueue::~TaskEventQueue()
+{
+	delete[] cells;
+}
+
+/**
+ * Discard every event and (re)allocate room for at least the given
+ * number of pending events. Must not be called while producers are active.
+ *
+ * @param capacity - the minimum number of pending events
+ */
+void TaskEventQueue::reset(unsigned int capacity)
+{
+	unsigned int size = 1;
+
+	// Round up to a power of two so positions wrap with a mask
+	while (size < capacity)
+	{
+		size <<= 1;
+	}
+
+	delete[] cells;
+	cells = new Cell[size];
+	mask = size - 1;
+
+	// Cell i is free for the producer at position i
+	for (unsigned int i = 0; i < size; i++)
+	{
+		cells[i].sequence = i;
+		cells[i].id = 0;
+	}
+	tail = 0;
+	head = 0;
+	overflow = false;
+}
+
+/**
+ * Remove the oldest task ID from the queue (consumer only).
+ *
+ * @param id - set to the task ID
+ * @return false if no event is pending or events were lost (in which
+ *         case the queue is emptied and every task must be rescheduled)
+ */
+bool TaskEventQueue::pop(unsigned int* id)
+{
+	Cell* cell;
+	bool lost = overflow;
+
+	if (lost)
+	{
+		overflow = false;
+		__sync_synchronize();
+	}
+
+	for (;;)
+	{
+		cell = &cells[head & mask];
+		if ((int)(cell->sequence - (head + 1)) < 0)
+		{
+			return false; // empty (or a producer has not published yet)
+		}
+
+		*id = cell->id;
+		__sync_synchronize(); // read the ID before freeing the cell
+		cell->sequence = head + mask + 1;
+		head++;
+
+		// Start over with an empty queue after a full reschedule.
+		if (!lost)
+		{
+			return true;
+		}
+	}
+}
@@ -0,0 +1,126 @@
+//*****************************************************************
+// TaskEventQueue.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TASKEVENTQUEUE_H_
+#define TASKEVENTQUEUE_H_
+
+// Module includes
+#include "Project1.h"
+
+/**
+ * This class is a bounded, lock-free multi-producer/single-consumer queue
+ * of task IDs (the tasks whose period expired). Each cell carries a
+ * sequence number, so a producer claims a cell with one compare-and-swap
+ * on the tail and publishes it by advancing the cell's sequence; producers
+ * on different cores never take a lock and the consumer (the proxy
+ * scheduler) never blocks them. If the queue is full the event is not
+ * stored and the queue is flagged as overflowed, which tells the consumer
+ * to fall back to a full reschedule.
+ */
+class TaskEventQueue
+{
+public:
+	/**
+	 * Default constructor for an empty (zero capacity) queue.
+	 */
+	TaskEventQueue();
+
+	/**
+	 * Default destructor that frees the queue storage.
+	 */
+	virtual ~TaskEventQueue();
+
+	/**
+	 * Discard every event and (re)allocate room for at least the given
+	 * number of pending events. Must not be called while producers are active.
+	 *
+	 * @param capacity - the minimum number of pending events
+	 */
+	void reset(unsigned int capacity);
+
+	/**
+	 * Append a task ID to the queue (safe to call from any thread).
+	 *
+	 * @param id - the task ID
+	 */
+	inline void push(unsigned int id)
+	{
+		unsigned int position = tail;
+		Cell* cell;
+		int difference;
+
+		for (;;)
+		{
+			cell = &cells[position & mask];
+			difference = (int)(cell->sequence - position);
+			if (difference == 0)
+			{
+				// The cell is free; claim it unless another producer got there first
+				unsigned int previous = __sync_val_compare_and_swap(&tail, position, position + 1);
+				if (previous == position)
+				{
+					break;
+				}
+				position = previous;
+			}
+			else if (difference < 0)
+			{
+				// Full (the consumer has not drained this cell yet)
+				overflow = true;
+				__sync_synchronize();
+				return;
+			}
+			else
+			{
+				position = tail;
+			}
+		}
+
+		cell->id = id;
+		__sync_synchronize(); // publish the ID before the sequence
+		cell->sequence = position + 1;
+	}
+
+	/**
+	 * Remove the oldest task ID from the queue (consumer only).
+	 *
+	 * @param id - set to the task ID
+	 * @return false if no event is pending or events were lost (in which
+	 *         case the queue is emptied and every task must be rescheduled)
+	 */
+	bool pop(unsigned int* id);
+
+private:
+	// Size of a cache line in bytes
+	static const unsigned int CACHE_LINE_SIZE = 64;
+
+	// A single queue slot
+	typedef struct
+	{
+		volatile unsigned int sequence;
+		unsigned int id;
+	} Cell;
+
+	// Queue storage (a power of two number of cells) and its index mask
+	Cell* cells;
+	unsigned int mask;
+
+	// Producer (tail) and consumer (head) positions, kept on separate
+	// cache lines so producers and the consumer do not contend
+	volatile unsigned int tail;
+	char tailPadding[CACHE_LINE_SIZE - sizeof(unsigned int)];
+	unsigned int head;
+	char headPadding[CACHE_LINE_SIZE - sizeof(unsigned int)];
+
+	// Set when an event could not be stored
+	volatile bool overflow;
+};
+
+#endif /* TASKEVENTQUEUE_H_ */
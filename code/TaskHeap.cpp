@@ -0,0 +1,292 @@
+//*****************************************************************
+// TaskHeap.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TaskHeap.h"
+#include <algorithm>
+
+// Static member definitions
+const unsigned int TaskHeap::NOT_IN_HEAP;
+
+/**
+ * Default constructor for an empty heap.
+ */
+TaskHeap::TaskHeap()
+{
+}
+
+/**
+ * Default, empty destructor.
+ */
+TaskHeap::~TaskHeap()
+{
+}
+
+/**
+ * Remove every task from the heap.
+ */
+void TaskHeap::clear()
+{
+	nodes.clear();
+	position.clear();
+}
+
+/**
+ * Allocate room for a number of tasks up front, so pushing them (and
+ * retrieving them with topK()) never allocates.
+ *
+ * @param capacity - the number of tasks
+ * @param idLimit - one more than the largest task ID
+ */
+void TaskHeap::reserve(unsigned int capacity, unsigned int idLimit)
+{
+	nodes.reserve(capacity);
+	frontier.reserve(capacity + 1);
+	if (idLimit > position.size())
+	{
+		position.resize(idLimit, NOT_IN_HEAP);
+	}
+}
+
+/**
+ * Determine whether the given task is in the heap.
+ *
+ * @param id - the task ID
+ * @return true if the task is in the heap
+ */
+bool TaskHeap::contains(unsigned int id) const
+{
+	return (id < position.size()) && (position[id] != NOT_IN_HEAP);
+}
+
+/**
+ * Insert a task into the heap.
+ *
+ * @param id - the task ID (must not already be in the heap)
+ * @param key - the task's scheduling key
+ */
+void TaskHeap::push(unsigned int id, uint64_t key)
+{
+	Node node;
+
+	if (id >= position.size())
+	{
+		position.resize(id + 1, NOT_IN_HEAP);
+	}
+
+	node.key = key;
+	node.id = id;
+	nodes.push_back(node);
+	position[id] = nodes.size() - 1;
+	siftUp(nodes.size() - 1);
+}
+
+/**
+ * Change the key of a task that is already in the heap.
+ *
+ * @param id - the task ID
+ * @param key - the task's new scheduling key
+ */
+void TaskHeap::update(unsigned int id, uint64_t key)
+{
+	unsigned int slot = position[id];
+	uint64_t oldKey = nodes[slot].key;
+
+	nodes[slot].key = key;
+	if (key < oldKey)
+	{
+		siftUp(slot);
+	}
+	else
+	{
+		siftDown(slot);
+	}
+}
+
+/**
+ * Remove a task from the heap.
+ *
+ * @param id - the task ID
+ */
+void TaskHeap::remove(unsigned int id)
+{
+	unsigned int slot = position[id];
+	Node last = nodes.back();
+
+	nodes.pop_back();
+	position[id] = NOT_IN_HEAP;
+
+	// Fill the hole with the last node and restore the heap order.
+	if (slot < nodes.size())
+	{
+		place(slot, last);
+		siftUp(slot);
+		siftDown(position[last.id]);
+	}
+}
+
+/**
+ * Retrieve the current key of a task in the heap.
+ *
+ * @param id - the task ID
+ * @return the task's scheduling key
+ */
+uint64_t TaskHeap::key(unsigned int id) const
+{
+	return nodes[position[id]].key;
+}
+
+/**
+ * Determine whether one task is ordered before another in the heap
+ * (both tasks must be in the heap).
+ *
+ * @param a - the first task ID
+ * @param b - the second task ID
+ * @return true if task a has the smaller key (or equal key and lower ID)
+ */
+bool TaskHeap::precedes(unsigned int a, unsigned int b) const
+{
+	return before(nodes[position[a]], nodes[position[b]]);
+}
+
+/**
+ * Retrieve the task with the smallest key.
+ *
+ * @return task ID at the top of the heap
+ */
+unsigned int TaskHeap::top() const
+{
+	return nodes[0].id;
+}
+
+/**
+ * Retrieve the number of tasks in the heap.
+ *
+ * @return heap size
+ */
+unsigned int TaskHeap::size() const
+{
+	return nodes.size();
+}
+
+/**
+ * Determine whether the heap is empty.
+ *
+ * @return true if the heap is empty
+ */
+bool TaskHeap::empty() const
+{
+	return nodes.empty();
+}
+
+/**
+ * Frontier ordering used by topK() (std heap functions build a max-heap,
+ * so the comparison is reversed to keep the smallest slot on top).
+ */
+struct FrontierOrder
+{
+	const vector<TaskHeap::Node>* nodes;
+
+	bool operator()(unsigned int a, unsigned int b) const
+	{
+		const TaskHeap::Node& x = (*nodes)[a];
+		const TaskHeap::Node& y = (*nodes)[b];
+		return (y.key < x.key) || (y.key == x.key && y.id < x.id);
+	}
+};
+
+/**
+ * Append the k tasks with the smallest keys to a list in ascending
+ * key order in O(k log k), without modifying the heap.
+ *
+ * @param k - the number of tasks to retrieve
+ * @param order - the list the task IDs are appended to
+ */
+void TaskHeap::topK(unsigned int k, vector<unsigned int>& order) const
+{
+	FrontierOrder compare;
+	unsigned int slot;
+	unsigned int child;
+
+	compare.nodes = &nodes;
+	frontier.clear();
+	if (!nodes.empty())
+	{
+		frontier.push_back(0);
+	}
+
+	// The next smallest node is always the root or a child of a node
+	// that has already been output, so only the frontier is searched.
+	while (k > 0 && !frontier.empty())
+	{
+		pop_heap(frontier.begin(), frontier.end(), compare);
+		slot = frontier.back();
+		frontier.pop_back();
+		order.push_back(nodes[slot].id);
+		k--;
+
+		for (child = (2 * slot) + 1; child <= (2 * slot) + 2 && child < nodes.size(); child++)
+		{
+			frontier.push_back(child);
+			push_heap(frontier.begin(), frontier.end(), compare);
+		}
+	}
+}
+
+/**
+ * Move the node at the given slot up until the heap is ordered.
+ *
+ * @param slot - heap slot
+ */
+void TaskHeap::siftUp(unsigned int slot)
+{
+	Node node = nodes[slot];
+	unsigned int parent;
+
+	while (slot > 0)
+	{
+		parent = (slot - 1) / 2;
+		if (!before(node, nodes[parent]))
+		{
+			break;
+		}
+		place(slot, nodes[parent]);
+		slot = parent;
+	}
+	place(slot, node);
+}
+
+/**
+ * Move the node at the given slot down until the heap is ordered.
+ *
+ * @param slot - heap slot
+ */
+void TaskHeap::siftDown(unsigned int slot)
+{
+	Node node = nodes[slot];
+	unsigned int count = nodes.size();
+	unsigned int child;
+
+	while ((child = (2 * slot) + 1) < count)
+	{
+		// Pick the smaller of the two children.
+		if (child + 1 < count && before(nodes[child + 1], nodes[child]))
+		{
+			child++;
+		}
+		if (!before(nodes[child], node))
+		{
+			break;
+		}
+		place(slot, nodes[child]);
+		slot = child;
+	}
+	place(slot, node);
+}
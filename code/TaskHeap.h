@@ -0,0 +1,188 @@
+//*****************************************************************
+// TaskHeap.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TASKHEAP_H_
+#define TASKHEAP_H_
+
+// Module includes
+#include "Project1.h"
+
+/**
+ * This class is an indexed binary min-heap of task IDs ordered by a
+ * 64-bit scheduling key (ties are broken by the lower task ID). The
+ * index from task ID to heap slot allows the key of any task to be
+ * changed in O(log n), so the heap can persist across scheduling
+ * events instead of being rebuilt on each one.
+ */
+class TaskHeap
+{
+	// Ordering functor used by topK()
+	friend struct FrontierOrder;
+
+public:
+	/**
+	 * Default constructor for an empty heap.
+	 */
+	TaskHeap();
+
+	/**
+	 * Default, empty destructor.
+	 */
+	virtual ~TaskHeap();
+
+	/**
+	 * Remove every task from the heap.
+	 */
+	void clear();
+
+	/**
+	 * Allocate room for a number of tasks up front, so pushing them (and
+	 * retrieving them with topK()) never allocates.
+	 *
+	 * @param capacity - the number of tasks
+	 * @param idLimit - one more than the largest task ID
+	 */
+	void reserve(unsigned int capacity, unsigned int idLimit);
+
+	/**
+	 * Determine whether the given task is in the heap.
+	 *
+	 * @param id - the task ID
+	 * @return true if the task is in the heap
+	 */
+	bool contains(unsigned int id) const;
+
+	/**
+	 * Insert a task into the heap.
+	 *
+	 * @param id - the task ID (must not already be in the heap)
+	 * @param key - the task's scheduling key
+	 */
+	void push(unsigned int id, uint64_t key);
+
+	/**
+	 * Change the key of a task that is already in the heap.
+	 *
+	 * @param id - the task ID
+	 * @param key - the task's new scheduling key
+	 */
+	void update(unsigned int id, uint64_t key);
+
+	/**
+	 * Remove a task from the heap.
+	 *
+	 * @param id - the task ID
+	 */
+	void remove(unsigned int id);
+
+	/**
+	 * Retrieve the current key of a task in the heap.
+	 *
+	 * @param id - the task ID
+	 * @return the task's scheduling key
+	 */
+	uint64_t key(unsigned int id) const;
+
+	/**
+	 * Determine whether one task is ordered before another in the heap
+	 * (both tasks must be in the heap).
+	 *
+	 * @param a - the first task ID
+	 * @param b - the second task ID
+	 * @return true if task a has the smaller key (or equal key and lower ID)
+	 */
+	bool precedes(unsigned int a, unsigned int b) const;
+
+	/**
+	 * Retrieve the task with the smallest key.
+	 *
+	 * @return task ID at the top of the heap
+	 */
+	unsigned int top() const;
+
+	/**
+	 * Retrieve the number of tasks in the heap.
+	 *
+	 * @return heap size
+	 */
+	unsigned int size() const;
+
+	/**
+	 * Determine whether the heap is empty.
+	 *
+	 * @return true if the heap is empty
+	 */
+	bool empty() const;
+
+	/**
+	 * Append the k tasks with the smallest keys to a list in ascending
+	 * key order in O(k log k), without modifying the heap.
+	 *
+	 * @param k - the number of tasks to retrieve
+	 * @param order - the list the task IDs are appended to
+	 */
+	void topK(unsigned int k, vector<unsigned int>& order) const;
+
+private:
+	// A single heap slot
+	typedef struct
+	{
+		uint64_t key;
+		unsigned int id;
+	} Node;
+
+	/**
+	 * Heap ordering (smaller key first, then lower task ID).
+	 */
+	static inline bool before(const Node& a, const Node& b)
+	{
+		return (a.key < b.key) || (a.key == b.key && a.id < b.id);
+	}
+
+	/**
+	 * Move the node at the given slot up until the heap is ordered.
+	 *
+	 * @param slot - heap slot
+	 */
+	void siftUp(unsigned int slot);
+
+	/**
+	 * Move the node at the given slot down until the heap is ordered.
+	 *
+	 * @param slot - heap slot
+	 */
+	void siftDown(unsigned int slot);
+
+	/**
+	 * Place a node in a slot and update the task index.
+	 *
+	 * @param slot - heap slot
+	 * @param node - the node to place
+	 */
+	inline void place(unsigned int slot, const Node& node)
+	{
+		nodes[slot] = node;
+		position[node.id] = slot;
+	}
+
+	// The heap array
+	vector<Node> nodes;
+
+	// Index from task ID to heap slot (NOT_IN_HEAP if absent)
+	vector<unsigned int> position;
+
+	// Scratch frontier used by topK() (kept to avoid reallocation)
+	mutable vector<unsigned int> frontier;
+
+	// Position value for tasks that are not in the heap
+	static const unsigned int NOT_IN_HEAP = 0xFFFFFFFF;
+};
+
+#endif /* TASKHEAP_H_ */
@@ -0,0 +1,112 @@
+//*****************************************************************
+// TaskPool.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TaskPool.h"
+
+/**
+ * Default constructor for an empty pool.
+ */
+TaskPool::TaskPool()
+{
+	pthread_mutex_init(&lock, NULL);
+}
+
+/**
+ * Default destructor that stops and destroys every pooled task.
+ */
+TaskPool::~TaskPool()
+{
+	for (vector<Task*>::iterator itr = tasks.begin(); itr != tasks.end(); itr++)
+	{
+		// Only a started thread is joined
+		if ((*itr)->isAlive())
+		{
+			(*itr)->stopTask();
+			(*itr)->join();
+		}
+		delete(*itr);
+	}
+	pthread_mutex_destroy(&lock);
+}
+
+/**
+ * Retrieve a task for a new schedule test, reusing an idle task
+ * pinned to the same CPU if there is one. A new task is started by
+ * the proxy scheduler as usual (see Thread::isAlive()).
+ *
+ * @param id - the task's unique ID
+ * @param computeTime - the tasks's compute time
+ * @param periodTime - the tasks's period time
+ * @param table - the table that holds the task's scheduling keys
+ * @param cpu - the CPU the task is pinned to (or Thread::NO_CPU)
+ * @return the task (owned by the pool)
+ */
+Task* TaskPool::acquire(int id, int computeTime, int periodTime, TaskTable* table, int cpu)
+{
+	Task* task = NULL;
+
+	pthread_mutex_lock(&lock);
+	for (vector<Task*>::iterator itr = idle.begin(); itr != idle.end(); itr++)
+	{
+		if ((*itr)->getCpu() == cpu)
+		{
+			task = *itr;
+			idle.erase(itr);
+			break;
+		}
+	}
+	pthread_mutex_unlock(&lock);
+
+	// Re-parameterize the idle thread, or create a new task
+	if (task != NULL)
+	{
+		task->assign(id, computeTime, periodTime, table);
+	}
+	else
+	{
+		task = new Task(id, computeTime, periodTime, table);
+		task->setCpu(cpu);
+		pthread_mutex_lock(&lock);
+		tasks.push_back(task);
+		pthread_mutex_unlock(&lock);
+	}
+
+	return task;
+}
+
+/**
+ * Return a task to the pool once its schedule test was stopped
+ * (blocks until the task thread has left the test).
+ *
+ * @param task - the task
+ */
+void TaskPool::release(Task* task)
+{
+	task->waitIdle();
+	pthread_mutex_lock(&lock);
+	idle.push_back(task);
+	pthread_mutex_unlock(&lock);
+}
+
+/**
+ * Retrieve the number of task threads the pool has created.
+ *
+ * @return number of task threads
+ */
+unsigned int TaskPool::size()
+{
+	unsigned int count;
+
+	pthread_mutex_lock(&lock);
+	count = tasks.size();
+	pthread_mutex_unlock(&lock);
+	return count;
+}
@@ -0,0 +1,77 @@
+//*****************************************************************
+// TaskPool.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TASKPOOL_H_
+#define TASKPOOL_H_
+
+// Module includes
+#include "Project1.h"
+#include "Task.h"
+#include <pthread.h>
+
+/**
+ * This class keeps the task threads of finished schedule tests alive so
+ * that later tests (e.g. the experiments of a batch run) re-parameterize
+ * them instead of creating and tearing down a thread per task. A task is
+ * only reused on the CPU it was pinned to when its thread started.
+ * Concurrent (partitioned) proxy schedulers may share a pool.
+ */
+class TaskPool
+{
+public:
+	/**
+	 * Default constructor for an empty pool.
+	 */
+	TaskPool();
+
+	/**
+	 * Default destructor that stops and destroys every pooled task.
+	 */
+	virtual ~TaskPool();
+
+	/**
+	 * Retrieve a task for a new schedule test, reusing an idle task
+	 * pinned to the same CPU if there is one. A new task is started by
+	 * the proxy scheduler as usual (see Thread::isAlive()).
+	 *
+	 * @param id - the task's unique ID
+	 * @param computeTime - the tasks's compute time
+	 * @param periodTime - the tasks's period time
+	 * @param table - the table that holds the task's scheduling keys
+	 * @param cpu - the CPU the task is pinned to (or Thread::NO_CPU)
+	 * @return the task (owned by the pool)
+	 */
+	Task* acquire(int id, int computeTime, int periodTime, TaskTable* table, int cpu);
+
+	/**
+	 * Return a task to the pool once its schedule test was stopped
+	 * (blocks until the task thread has left the test).
+	 *
+	 * @param task - the task
+	 */
+	void release(Task* task);
+
+	/**
+	 * Retrieve the number of task threads the pool has created.
+	 *
+	 * @return number of task threads
+	 */
+	unsigned int size();
+
+private:
+	// Every task the pool created and the ones that are idle
+	vector<Task*> tasks;
+	vector<Task*> idle;
+
+	// Lock that protects the lists
+	pthread_mutex_t lock;
+};
+
+#endif /* TASKPOOL_H_ */
@@ -0,0 +1,359 @@
+//*****************************************************************
+// TaskSelect.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TaskSelect.h"
+
+// The vector kernels are only built for x86 (with GCC function targets)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TASKSELECT_X86
+#include <immintrin.h>
+#endif
+
+// Static member definitions
+const unsigned int TaskSelect::NO_SLOT;
+SelectKernel TaskSelect::kernel = TaskSelect::bestKernel();
+TaskSelect::NextFunction TaskSelect::next = TaskSelect::kernelFunction(TaskSelect::kernel);
+
+/**
+ * Determine whether one task orders before another (smaller key first,
+ * then lower task ID).
+ */
+static inline bool precedes(unsigned int keyA, unsigned int idA, unsigned int keyB, unsigned int idB)
+{
+	return (keyA < keyB) || (keyA == keyB && idA < idB);
+}
+
+/**
+ * Consider a single slot for the next selected task.
+ *
+ * @param slot - the slot
+ * @param best - the best slot so far (updated)
+ */
+static inline void consider(unsigned int slot, const unsigned int* keys, const unsigned int* ids,
+		const volatile int* backlogs, bool bounded, unsigned int afterKey, unsigned int afterID,
+		unsigned int& best)
+{
+	if (backlogs[slot] <= 0)
+	{
+		return;
+	}
+	if (bounded && !precedes(afterKey, afterID, keys[slot], ids[slot]))
+	{
+		return;
+	}
+	if (best == TaskSelect::NO_SLOT || precedes(keys[slot], ids[slot], keys[best], ids[best]))
+	{
+		best = slot;
+	}
+}
+
+/**
+ * Scalar kernel: one slot at a time.
+ */
+static unsigned int nextScalar(const unsigned int* keys, const unsigned int* ids,
+		const volatile int* backlogs, unsigned int count, bool bounded,
+		unsigned int afterKey, unsigned int afterID)
+{
+	unsigned int best = TaskSelect::NO_SLOT;
+
+	for (unsigned int slot = 0; slot < count; slot++)
+	{
+		consider(slot, keys, ids, backlogs, bounded, afterKey, afterID, best);
+	}
+
+	return best;
+}
+
+#ifdef TASKSELECT_X86
+
+/**
+ * SSE2 kernel: four slots at a time. Each lane keeps the best slot it has
+ * seen (unsigned keys and IDs are compared as signed after flipping the
+ * sign bit), and the lanes and any remaining slots are merged at the end.
+ */
+__attribute__((target("sse2")))
+static unsigned int nextSSE2(const unsigned int* keys, const unsigned int* ids,
+		const volatile int* backlogs, unsigned int count, bool bounded,
+		unsigned int afterKey, unsigned int afterID)
+{
+	const __m128i bias = _mm_set1_epi32((int)0x80000000);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i none = _mm_set1_epi32(-1);
+	const __m128i step = _mm_set1_epi32(4);
+	const __m128i afterK = _mm_set1_epi32((int)(afterKey ^ 0x80000000));
+	const __m128i afterI = _mm_set1_epi32((int)(afterID ^ 0x80000000));
+	const __m128i unbounded = bounded ? zero : none;
+	__m128i bestK = zero;
+	__m128i bestI = zero;
+	__m128i bestS = none;
+	__m128i slot = _mm_setr_epi32(0, 1, 2, 3);
+	__m128i k;
+	__m128i id;
+	__m128i valid;
+	__m128i better;
+	unsigned int laneSlots[4];
+	unsigned int best = TaskSelect::NO_SLOT;
+	unsigned int i;
+
+	for (i = 0; i + 4 <= count; i += 4)
+	{
+		k = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(keys + i)), bias);
+		id = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(ids + i)), bias);
+
+		// Pending, and after the previously selected task
+		valid = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(const int*)(backlogs + i)), zero);
+		valid = _mm_and_si128(valid, _mm_or_si128(unbounded, _mm_or_si128(_mm_cmpgt_epi32(k, afterK),
+				_mm_and_si128(_mm_cmpeq_epi32(k, afterK), _mm_cmpgt_epi32(id, afterI)))));
+
+		// Before the lane's best so far (or the lane has none yet)
+		better = _mm_or_si128(_mm_cmpeq_epi32(bestS, none), _mm_or_si128(_mm_cmplt_epi32(k, bestK),
+				_mm_and_si128(_mm_cmpeq_epi32(k, bestK), _mm_cmplt_epi32(id, bestI))));
+		better = _mm_and_si128(better, valid);
+
+		bestK = _mm_or_si128(_mm_and_si128(better, k), _mm_andnot_si128(better, bestK));
+		bestI = _mm_or_si128(_mm_and_si128(better, id), _mm_andnot_si128(better, bestI));
+		bestS = _mm_or_si128(_mm_and_si128(better, slot), _mm_andnot_si128(better, bestS));
+		slot = _mm_add_epi32(slot, step);
+	}
+
+	_mm_storeu_si128((__m128i*)laneSlots, bestS);
+	for (unsigned int lane = 0; lane < 4; lane++)
+	{
+		if (laneSlots[lane] != TaskSelect::NO_SLOT && (best == TaskSelect::NO_SLOT ||
+				precedes(keys[laneSlots[lane]], ids[laneSlots[lane]], keys[best], ids[best])))
+		{
+			best = laneSlots[lane];
+		}
+	}
+	for (; i < count; i++)
+	{
+		consider(i, keys, ids, backlogs, bounded, afterKey, afterID, best);
+	}
+
+	return best;
+}
+
+/**
+ * AVX2 kernel: eight slots at a time (see nextSSE2()).
+ */
+__attribute__((target("avx2")))
+static unsigned int nextAVX2(const unsigned int* keys, const unsigned int* ids,
+		const volatile int* backlogs, unsigned int count, bool bounded,
+		unsigned int afterKey, unsigned int afterID)
+{
+	const __m256i bias = _mm256_set1_epi32((int)0x80000000);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i none = _mm256_set1_epi32(-1);
+	const __m256i step = _mm256_set1_epi32(8);
+	const __m256i afterK = _mm256_set1_epi32((int)(afterKey ^ 0x80000000));
+	const __m256i afterI = _mm256_set1_epi32((int)(afterID ^ 0x80000000));
+	const __m256i unbounded = bounded ? zero : none;
+	__m256i bestK = zero;
+	__m256i bestI = zero;
+	__m256i bestS = none;
+	__m256i slot = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i k;
+	__m256i id;
+	__m256i valid;
+	__m256i better;
+	unsigned int laneSlots[8];
+	unsigned int best = TaskSelect::NO_SLOT;
+	unsigned int i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		k = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(keys + i)), bias);
+		id = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(ids + i)), bias);
+
+		// Pending, and after the previously selected task
+		valid = _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(const int*)(backlogs + i)), zero);
+		valid = _mm256_and_si256(valid, _mm256_or_si256(unbounded, _mm256_or_si256(_mm256_cmpgt_epi32(k, afterK),
+				_mm256_and_si256(_mm256_cmpeq_epi32(k, afterK), _mm256_cmpgt_epi32(id, afterI)))));
+
+		// Before the lane's best so far (or the lane has none yet)
+		better = _mm256_or_si256(_mm256_cmpeq_epi32(bestS, none), _mm256_or_si256(_mm256_cmpgt_epi32(bestK, k),
+				_mm256_and_si256(_mm256_cmpeq_epi32(k, bestK), _mm256_cmpgt_epi32(bestI, id))));
+		better = _mm256_and_si256(better, valid);
+
+		bestK = _mm256_blendv_epi8(bestK, k, better);
+		bestI = _mm256_blendv_epi8(bestI, id, better);
+		bestS = _mm256_blendv_epi8(bestS, slot, better);
+		slot = _mm256_add_epi32(slot, step);
+	}
+
+	_mm256_storeu_si256((__m256i*)laneSlots, bestS);
+	for (unsigned int lane = 0; lane < 8; lane++)
+	{
+		if (laneSlots[lane] != TaskSelect::NO_SLOT && (best == TaskSelect::NO_SLOT ||
+				precedes(keys[laneSlots[lane]], ids[laneSlots[lane]], keys[best], ids[best])))
+		{
+			best = laneSlots[lane];
+		}
+	}
+	for (; i < count; i++)
+	{
+		consider(i, keys, ids, backlogs, bounded, afterKey, afterID, best);
+	}
+
+	return best;
+}
+
+#endif /* TASKSELECT_X86 */
+
+/**
+ * Select the pending tasks with the smallest keys.
+ *
+ * @param keys - the key of every slot
+ * @param ids - the task ID of every slot
+ * @param backlogs - the number of pending compute cycles of every slot
+ * @param count - the number of slots
+ * @param k - the (maximum) number of tasks to select
+ * @param slots - set to the slots of the selected tasks, smallest key first
+ * @return the number of tasks selected (less than k if fewer are pending)
+ */
+unsigned int TaskSelect::selectTop(const unsigned int* keys, const unsigned int* ids,
+		const volatile int* backlogs, unsigned int count, unsigned int k, unsigned int* slots)
+{
+	unsigned int found = 0;
+	unsigned int slot;
+	bool bounded = false;
+	unsigned int afterKey = 0;
+	unsigned int afterID = 0;
+
+	// Each pass finds the task that orders right after the previous one
+	while (found < k)
+	{
+		slot = next(keys, ids, backlogs, count, bounded, afterKey, afterID);
+		if (slot == NO_SLOT)
+		{
+			break;
+		}
+		slots[found++] = slot;
+		bounded = true;
+		afterKey = keys[slot];
+		afterID = ids[slot];
+	}
+
+	return found;
+}
+
+/**
+ * Select the kernel used by selectTop().
+ *
+ * @param kernel - the kernel
+ * @return false if the CPU does not support the kernel (the kernel is unchanged)
+ */
+bool TaskSelect::setKernel(SelectKernel kernel)
+{
+	if (!supported(kernel))
+	{
+		return false;
+	}
+
+	TaskSelect::kernel = kernel;
+	next = kernelFunction(kernel);
+	return true;
+}
+
+/**
+ * Retrieve the kernel used by selectTop().
+ *
+ * @return the kernel
+ */
+SelectKernel TaskSelect::getKernel()
+{
+	return kernel;
+}
+
+/**
+ * Determine whether the CPU supports a kernel.
+ *
+ * @param kernel - the kernel
+ * @return true if the kernel can be used
+ */
+bool TaskSelect::supported(SelectKernel kernel)
+{
+	switch (kernel)
+	{
+	case SELECT_KERNEL_SCALAR:
+		return true;
+#ifdef TASKSELECT_X86
+	case SELECT_KERNEL_SSE2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("sse2");
+	case SELECT_KERNEL_AVX2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#endif
+	default:
+		return false;
+	}
+}
+
+/**
+ * Retrieve the name of a kernel.
+ *
+ * @param kernel - the kernel
+ * @return "scalar", "sse2" or "avx2"
+ */
+const char* TaskSelect::kernelName(SelectKernel kernel)
+{
+	switch (kernel)
+	{
+	case SELECT_KERNEL_SCALAR:
+		return "scalar";
+	case SELECT_KERNEL_SSE2:
+		return "sse2";
+	case SELECT_KERNEL_AVX2:
+		return "avx2";
+	default:
+		return "unknown";
+	}
+}
+
+/**
+ * Retrieve the widest kernel the CPU supports.
+ *
+ * @return the kernel
+ */
+SelectKernel TaskSelect::bestKernel()
+{
+	if (supported(SELECT_KERNEL_AVX2))
+	{
+		return SELECT_KERNEL_AVX2;
+	}
+	if (supported(SELECT_KERNEL_SSE2))
+	{
+		return SELECT_KERNEL_SSE2;
+	}
+	return SELECT_KERNEL_SCALAR;
+}
+
+/**
+ * Retrieve the function that implements a kernel.
+ *
+ * @param kernel - the kernel
+ * @return the kernel function
+ */
+TaskSelect::NextFunction TaskSelect::kernelFunction(SelectKernel kernel)
+{
+	switch (kernel)
+	{
+#ifdef TASKSELECT_X86
+	case SELECT_KERNEL_SSE2:
+		return &nextSSE2;
+	case SELECT_KERNEL_AVX2:
+		return &nextAVX2;
+#endif
+	default:
+		return &nextScalar;
+	}
+}
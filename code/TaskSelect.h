@@ -0,0 +1,116 @@
+//*****************************************************************
+// TaskSelect.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TASKSELECT_H_
+#define TASKSELECT_H_
+
+// Module includes
+#include "Project1.h"
+
+// Enumeration of the selection kernel implementations
+typedef enum
+{
+	SELECT_KERNEL_SCALAR,
+	SELECT_KERNEL_SSE2,
+	SELECT_KERNEL_AVX2,
+	SELECT_KERNEL_LAST_ENTRY
+} SelectKernel;
+
+/**
+ * This class is responsible for selecting the few highest priority tasks
+ * straight from the key arrays of a TaskTable (the deadlines for EDF or
+ * the remaining compute times for SCT), without ordering every task. The
+ * tasks are ordered by key and then by task ID, so the selection is
+ * deterministic, and only the tasks with a pending compute cycle are
+ * considered. Each of the selected tasks is found with one vectorized
+ * pass over the arrays; the widest kernel the CPU supports is chosen at
+ * startup (x86 only, with a scalar fallback).
+ *
+ * NOTE: ALL METHODS ARE STATIC
+ */
+class TaskSelect
+{
+public:
+	/**
+	 * Select the pending tasks with the smallest keys.
+	 *
+	 * @param keys - the key of every slot
+	 * @param ids - the task ID of every slot
+	 * @param backlogs - the number of pending compute cycles of every slot
+	 * @param count - the number of slots
+	 * @param k - the (maximum) number of tasks to select
+	 * @param slots - set to the slots of the selected tasks, smallest key first
+	 * @return the number of tasks selected (less than k if fewer are pending)
+	 */
+	static unsigned int selectTop(const unsigned int* keys, const unsigned int* ids,
+			const volatile int* backlogs, unsigned int count, unsigned int k, unsigned int* slots);
+
+	/**
+	 * Select the kernel used by selectTop().
+	 *
+	 * @param kernel - the kernel
+	 * @return false if the CPU does not support the kernel (the kernel is unchanged)
+	 */
+	static bool setKernel(SelectKernel kernel);
+
+	/**
+	 * Retrieve the kernel used by selectTop().
+	 *
+	 * @return the kernel
+	 */
+	static SelectKernel getKernel();
+
+	/**
+	 * Determine whether the CPU supports a kernel.
+	 *
+	 * @param kernel - the kernel
+	 * @return true if the kernel can be used
+	 */
+	static bool supported(SelectKernel kernel);
+
+	/**
+	 * Retrieve the name of a kernel.
+	 *
+	 * @param kernel - the kernel
+	 * @return "scalar", "sse2" or "avx2"
+	 */
+	static const char* kernelName(SelectKernel kernel);
+
+	// Slot value for "no task"
+	static const unsigned int NO_SLOT = 0xFFFFFFFF;
+
+private:
+	// A kernel that finds the pending slot with the smallest (key, task ID)
+	// that orders after (afterKey, afterID), if bounded, or NO_SLOT
+	typedef unsigned int (*NextFunction)(const unsigned int* keys, const unsigned int* ids,
+			const volatile int* backlogs, unsigned int count, bool bounded,
+			unsigned int afterKey, unsigned int afterID);
+
+	/**
+	 * Retrieve the widest kernel the CPU supports.
+	 *
+	 * @return the kernel
+	 */
+	static SelectKernel bestKernel();
+
+	/**
+	 * Retrieve the function that implements a kernel.
+	 *
+	 * @param kernel - the kernel
+	 * @return the kernel function
+	 */
+	static NextFunction kernelFunction(SelectKernel kernel);
+
+	// The kernel in use and its function
+	static SelectKernel kernel;
+	static NextFunction next;
+};
+
+#endif /* TASKSELECT_H_ */
@@ -0,0 +1,143 @@
+//*****************************************************************
+// TaskTable.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TaskTable.h"
+#include <cstring>
+#include <new>
+
+// Static member definitions
+const unsigned int TaskTable::NO_SLOT;
+
+/**
+ * Default constructor for an empty (zero capacity) table.
+ */
+TaskTable::TaskTable()
+{
+	taskIDs = NULL;
+	computeTimes = NULL;
+	periodTimes = NULL;
+	deadlines = NULL;
+	currentComputeTimes = NULL;
+	remainingTimes = NULL;
+	backlogs = NULL;
+	stats = NULL;
+	count = 0;
+	capacity = 0;
+}
+
+/**
+ * Default destructor that frees the table storage.
+ */
+TaskTable::~TaskTable()
+{
+	release();
+}
+
+/**
+ * Remove every task and (re)allocate room for the given number of tasks.
+ *
+ * @param capacity - the number of tasks
+ */
+void TaskTable::reset(unsigned int capacity)
+{
+	release();
+
+	taskIDs = (unsigned int*)allocate(capacity * sizeof(unsigned int));
+	computeTimes = (unsigned int*)allocate(capacity * sizeof(unsigned int));
+	periodTimes = (unsigned int*)allocate(capacity * sizeof(unsigned int));
+	deadlines = (unsigned int*)allocate(capacity * sizeof(unsigned int));
+	currentComputeTimes = (unsigned int*)allocate(capacity * sizeof(unsigned int));
+	remainingTimes = (unsigned int*)allocate(capacity * sizeof(unsigned int));
+	backlogs = (volatile int*)allocate(capacity * sizeof(int));
+	stats = (PaddedStats*)allocate(capacity * sizeof(PaddedStats));
+	slots.clear();
+	count = 0;
+	this->capacity = capacity;
+}
+
+/**
+ * Add a task to the table.
+ *
+ * @param id - the task's unique ID
+ * @param computeTime - the task's compute time (ms)
+ * @param periodTime - the task's period time (ms)
+ * @return the task's slot, or NO_SLOT if the table is full
+ */
+unsigned int TaskTable::add(unsigned int id, unsigned int computeTime, unsigned int periodTime)
+{
+	if (count == capacity)
+	{
+		return NO_SLOT;
+	}
+
+	if (id >= slots.size())
+	{
+		slots.resize(id + 1, NO_SLOT);
+	}
+	slots[id] = count;
+
+	// The first deadline is the end of the first period (whose compute cycle is pending)
+	taskIDs[count] = id;
+	computeTimes[count] = computeTime;
+	periodTimes[count] = periodTime;
+	deadlines[count] = periodTime;
+	currentComputeTimes[count] = 0;
+	remainingTimes[count] = computeTime * NS_PER_MS;
+	backlogs[count] = 1;
+
+	return count++;
+}
+
+/**
+ * Allocate a cache line aligned array.
+ *
+ * @param size - the size of the array in bytes
+ * @return the zeroed array
+ */
+void* TaskTable::allocate(unsigned int size)
+{
+	void* array = NULL;
+
+	// Round up to whole cache lines so no array shares its last line
+	size = ((size / CACHE_LINE_SIZE) + 1) * CACHE_LINE_SIZE;
+	if (posix_memalign(&array, CACHE_LINE_SIZE, size) != 0)
+	{
+		throw bad_alloc();
+	}
+	memset(array, 0, size);
+
+	return array;
+}
+
+/**
+ * Free every array of the table.
+ */
+void TaskTable::release()
+{
+	free(taskIDs);
+	free(computeTimes);
+	free(periodTimes);
+	free(deadlines);
+	free(currentComputeTimes);
+	free(remainingTimes);
+	free((void*)backlogs);
+	free(stats);
+	taskIDs = NULL;
+	computeTimes = NULL;
+	periodTimes = NULL;
+	deadlines = NULL;
+	currentComputeTimes = NULL;
+	remainingTimes = NULL;
+	backlogs = NULL;
+	stats = NULL;
+	count = 0;
+	capacity = 0;
+}
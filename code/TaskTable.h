@@ -0,0 +1,331 @@
+//*****************************************************************
+// TaskTable.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TASKTABLE_H_
+#define TASKTABLE_H_
+
+// Module includes
+#include "Project1.h"
+
+// Statistics collected for a task at runtime
+typedef struct
+{
+	unsigned int deadlineEvents;
+	unsigned int deadlinesMissed;
+	unsigned long totalComputationTimeMissed;
+	unsigned long totalComputationTime;
+	unsigned int totalComputationCycles;
+	uint64_t realComputeTime;
+	uint64_t computeTransitionTime;
+} TaskStats;
+
+/**
+ * This class holds the scheduling keys of a scheduler's tasks as a
+ * structure of arrays (one dense, cache line aligned array per key,
+ * indexed by the task's slot), so a scheduling algorithm that orders
+ * every task reads a few contiguous arrays instead of every Task object.
+ * The runtime statistics of each task are kept in a block of their own
+ * cache lines, so the threads that update them never share a line with
+ * another task's statistics or with the keys.
+ *
+ * Every task is added (by the Task constructor) before the test starts.
+ */
+class TaskTable
+{
+public:
+	/**
+	 * Default constructor for an empty (zero capacity) table.
+	 */
+	TaskTable();
+
+	/**
+	 * Default destructor that frees the table storage.
+	 */
+	virtual ~TaskTable();
+
+	/**
+	 * Remove every task and (re)allocate room for the given number of tasks.
+	 *
+	 * @param capacity - the number of tasks
+	 */
+	void reset(unsigned int capacity);
+
+	/**
+	 * Add a task to the table.
+	 *
+	 * @param id - the task's unique ID
+	 * @param computeTime - the task's compute time (ms)
+	 * @param periodTime - the task's period time (ms)
+	 * @return the task's slot, or NO_SLOT if the table is full
+	 */
+	unsigned int add(unsigned int id, unsigned int computeTime, unsigned int periodTime);
+
+	/**
+	 * Retrieve the number of tasks in the table.
+	 *
+	 * @return number of tasks
+	 */
+	inline unsigned int size() const
+	{
+		return count;
+	}
+
+	/**
+	 * Retrieve the slot of a task.
+	 *
+	 * @param id - the task ID (must be in the table)
+	 * @return the task's slot
+	 */
+	inline unsigned int slotOf(unsigned int id) const
+	{
+		return slots[id];
+	}
+
+	/**
+	 * Retrieve the ID of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return the task ID
+	 */
+	inline unsigned int getTaskID(unsigned int slot) const
+	{
+		return taskIDs[slot];
+	}
+
+	/**
+	 * Retrieve the compute time of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return compute time (ms)
+	 */
+	inline unsigned int getComputeTime(unsigned int slot) const
+	{
+		return computeTimes[slot];
+	}
+
+	/**
+	 * Retrieve the period time of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return period time (ms)
+	 */
+	inline unsigned int getPeriodTime(unsigned int slot) const
+	{
+		return periodTimes[slot];
+	}
+
+	/**
+	 * Retrieve the current deadline of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return current deadline (ms)
+	 */
+	inline unsigned int getDeadline(unsigned int slot) const
+	{
+		return deadlines[slot];
+	}
+
+	/**
+	 * Set the current deadline of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @param deadline - the new deadline (ms)
+	 */
+	inline void setDeadline(unsigned int slot, unsigned int deadline)
+	{
+		deadlines[slot] = deadline;
+	}
+
+	/**
+	 * Retrieve the compute time completed in the current compute cycle
+	 * of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return current compute time (ns)
+	 */
+	inline unsigned int getCurrentComputeTime(unsigned int slot) const
+	{
+		return currentComputeTimes[slot];
+	}
+
+	/**
+	 * Set the compute time completed in the current compute cycle of
+	 * the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @param time - the current compute time (ns)
+	 */
+	inline void setCurrentComputeTime(unsigned int slot, unsigned int time)
+	{
+		currentComputeTimes[slot] = time;
+		remainingTimes[slot] = (computeTimes[slot] * NS_PER_MS) - time;
+	}
+
+	/**
+	 * Retrieve the compute time remaining in the current compute cycle
+	 * of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return remaining compute time (ns)
+	 */
+	inline unsigned int getRemainingTime(unsigned int slot) const
+	{
+		return remainingTimes[slot];
+	}
+
+	/**
+	 * Retrieve the number of compute cycles the task in a slot has
+	 * pending (the current one and any backlogged ones).
+	 *
+	 * @param slot - the task's slot
+	 * @return number of pending compute cycles
+	 */
+	inline int getBacklog(unsigned int slot) const
+	{
+		return backlogs[slot];
+	}
+
+	/**
+	 * Set the number of compute cycles the task in a slot has pending.
+	 *
+	 * @param slot - the task's slot
+	 * @param backlog - the number of pending compute cycles
+	 */
+	inline void setBacklog(unsigned int slot, int backlog)
+	{
+		backlogs[slot] = backlog;
+	}
+
+	/**
+	 * Atomically add a compute cycle to the backlog of the task in a slot
+	 * (the timer and task threads update it concurrently).
+	 *
+	 * @param slot - the task's slot
+	 * @return the number of pending compute cycles before the increment
+	 */
+	inline int incrementBacklog(unsigned int slot)
+	{
+		return __sync_fetch_and_add(&backlogs[slot], 1);
+	}
+
+	/**
+	 * Atomically remove a completed compute cycle from the backlog of the
+	 * task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return the number of pending compute cycles before the decrement
+	 */
+	inline int decrementBacklog(unsigned int slot)
+	{
+		return __sync_fetch_and_sub(&backlogs[slot], 1);
+	}
+
+	/**
+	 * Retrieve the task ID array (indexed by slot).
+	 *
+	 * @return the task IDs of every slot
+	 */
+	inline const unsigned int* getTaskIDs() const
+	{
+		return taskIDs;
+	}
+
+	/**
+	 * Retrieve the deadline array (indexed by slot).
+	 *
+	 * @return the current deadline (ms) of every slot
+	 */
+	inline const unsigned int* getDeadlines() const
+	{
+		return deadlines;
+	}
+
+	/**
+	 * Retrieve the remaining compute time array (indexed by slot).
+	 *
+	 * @return the remaining compute time (ns) of every slot
+	 */
+	inline const unsigned int* getRemainingTimes() const
+	{
+		return remainingTimes;
+	}
+
+	/**
+	 * Retrieve the backlog array (indexed by slot).
+	 *
+	 * @return the number of pending compute cycles of every slot
+	 */
+	inline const volatile int* getBacklogs() const
+	{
+		return backlogs;
+	}
+
+	/**
+	 * Retrieve the runtime statistics of the task in a slot.
+	 *
+	 * @param slot - the task's slot
+	 * @return the task's statistics block
+	 */
+	inline TaskStats& getStats(unsigned int slot)
+	{
+		return stats[slot].stats;
+	}
+
+	// Slot value for a task that could not be added
+	static const unsigned int NO_SLOT = 0xFFFFFFFF;
+
+private:
+	// Size of a cache line in bytes
+	static const unsigned int CACHE_LINE_SIZE = 64;
+
+	// Nanoseconds per millisecond (compute times are in milliseconds)
+	static const unsigned int NS_PER_MS = 1000000;
+
+	// A task's statistics padded to a whole number of cache lines
+	typedef struct
+	{
+		TaskStats stats;
+		char padding[CACHE_LINE_SIZE - (sizeof(TaskStats) % CACHE_LINE_SIZE)];
+	} PaddedStats;
+
+	/**
+	 * Allocate a cache line aligned array.
+	 *
+	 * @param size - the size of the array in bytes
+	 * @return the zeroed array
+	 */
+	static void* allocate(unsigned int size);
+
+	/**
+	 * Free every array of the table.
+	 */
+	void release();
+
+	// The scheduling keys (indexed by slot)
+	unsigned int* taskIDs;
+	unsigned int* computeTimes;
+	unsigned int* periodTimes;
+	unsigned int* deadlines;
+	unsigned int* currentComputeTimes;
+	unsigned int* remainingTimes;
+	volatile int* backlogs;
+
+	// The runtime statistics (indexed by slot)
+	PaddedStats* stats;
+
+	// Index from task ID to slot
+	vector<unsigned int> slots;
+
+	// Number of tasks in the table and the number of slots allocated
+	unsigned int count;
+	unsigned int capacity;
+};
+
+#endif /* TASKTABLE_H_ */
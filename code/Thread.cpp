@@ -10,6 +10,7 @@
 
 // Module includes
 #include "Thread.h"
+#include "Platform.h"
 #include <stdexcept>
 #include <unistd.h>
 
@@ -18,7 +19,9 @@
  */
 Thread::Thread()
 {
-	// Empty constructor
+	alive = false;
+	cpu = NO_CPU;
+	startPriority = NO_PRIORITY;
 }
 
 /**
@@ -112,3 +115,58 @@ pthread_t Thread::threadID()
 {
 	return m_id;
 }
+
+/**
+ * Pin this thread to a single CPU once it starts (must be called
+ * before start()).
+ *
+ * @param cpu - the CPU index, or NO_CPU to let the OS choose
+ */
+void Thread::setCpu(int cpu)
+{
+	this->cpu = cpu;
+}
+
+/**
+ * Retrieve the CPU this thread is pinned to.
+ *
+ * @return the CPU index, or NO_CPU if the thread is not pinned
+ */
+int Thread::getCpu()
+{
+	return cpu;
+}
+
+/**
+ * Give this thread a real-time priority before its start routine runs,
+ * so it never runs under the default time-sharing policy (must be
+ * called before start()).
+ *
+ * @param priority - the real-time priority, or NO_PRIORITY to inherit
+ */
+void Thread::setStartPriority(int priority)
+{
+	this->startPriority = priority;
+}
+
+/**
+ * Pin the new thread and set its priority (if requested) and invoke
+ * its start routine.
+ */
+void* Thread::startRoutineTrampoline(void *p)
+{
+	Thread* pThis = (Thread*)p;
+	struct sched_param param;
+
+	// Affinity is set from the thread itself (QNX run masks require it)
+	if (pThis->cpu != NO_CPU)
+	{
+		Platform::bindToCpu(pThis->cpu);
+	}
+	if (pThis->startPriority != NO_PRIORITY)
+	{
+		param.sched_priority = pThis->startPriority;
+		Platform::setPriority(pthread_self(), &param);
+	}
+	return pThis->startRoutine();
+}
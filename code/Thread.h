@@ -89,6 +89,36 @@ public:
 	 */
 	pthread_t threadID();
 
+	/**
+	 * Pin this thread to a single CPU once it starts (must be called
+	 * before start()).
+	 *
+	 * @param cpu - the CPU index, or NO_CPU to let the OS choose
+	 */
+	void setCpu(int cpu);
+
+	/**
+	 * Retrieve the CPU this thread is pinned to.
+	 *
+	 * @return the CPU index, or NO_CPU if the thread is not pinned
+	 */
+	int getCpu();
+
+	/**
+	 * Give this thread a real-time priority before its start routine runs,
+	 * so it never runs under the default time-sharing policy (must be
+	 * called before start()).
+	 *
+	 * @param priority - the real-time priority, or NO_PRIORITY to inherit
+	 */
+	void setStartPriority(int priority);
+
+	// Marker value for a thread that is not pinned to a CPU
+	static const int NO_CPU = -1;
+
+	// Marker value for a thread that inherits its creator's priority
+	static const int NO_PRIORITY = -1;
+
 protected:
 	// Boolean flag indicating if this thread is still running.
 	volatile bool alive;
@@ -109,14 +139,17 @@ private:
 	// This thread's task ID
     pthread_t m_id;
 
+	// The CPU this thread is pinned to (NO_CPU if it is not pinned)
+	int cpu;
+
+	// The priority the thread starts with (NO_PRIORITY to inherit)
+	int startPriority;
+
 	/**
-	 * In-line function implementation due to its simplicity.
+	 * Pin the new thread and set its priority (if requested) and invoke
+	 * its start routine.
 	 */
-    static void *startRoutineTrampoline(void *p)
-    {
-        Thread* pThis = (Thread*)p;
-        return pThis->startRoutine();
-    }
+    static void *startRoutineTrampoline(void *p);
 };
 
 #endif /* THREAD_H_ */
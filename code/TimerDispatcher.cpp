@@ -0,0 +1,246 @@
+//*****************************************************************
+// TimerDispatcher.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TimerDispatcher.h"
+
+#ifndef __QNX__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#endif
+
+/**
+ * Default constructor that creates the (empty) dispatcher.
+ */
+TimerDispatcher::TimerDispatcher()
+{
+	dispatching = true;
+#ifdef __QNX__
+	channelID = ChannelCreate(0);
+	connectionID = ConnectAttach(0, 0, channelID, _NTO_SIDE_CHANNEL, 0);
+#else
+	struct epoll_event event;
+
+	epollFd = epoll_create(MAX_EVENTS);
+	stopFd = eventfd(0, 0);
+	event.events = EPOLLIN;
+	event.data.u32 = STOP_TOKEN;
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, stopFd, &event);
+#endif
+}
+
+/**
+ * Default destructor that destroys every timer.
+ */
+TimerDispatcher::~TimerDispatcher()
+{
+	for (vector<TimerEntry>::iterator itr = timers.begin(); itr != timers.end(); itr++)
+	{
+#ifdef __QNX__
+		timer_delete((*itr).timerID);
+#else
+		close((*itr).fd);
+#endif
+	}
+
+#ifdef __QNX__
+	ConnectDetach(connectionID);
+	ChannelDestroy(channelID);
+#else
+	close(stopFd);
+	close(epollFd);
+#endif
+}
+
+/**
+ * Register a new (disarmed) timer. Must be called before arm().
+ *
+ * @param initial - time from arm() until the first expiry in nanoseconds
+ * @param interval - time between subsequent expiries in nanoseconds
+ *                   (0 for a one-shot timer)
+ * @param callback - the function invoked on every expiry
+ * @param arg - the argument passed to the callback
+ * @return the timer index, or -1 if the timer could not be created
+ */
+int TimerDispatcher::addTimer(uint64_t initial, uint64_t interval, TimerCallback callback, void* arg)
+{
+	TimerEntry entry;
+	int index = timers.size();
+
+	entry.initial = initial;
+	entry.interval = interval;
+	entry.callback = callback;
+	entry.arg = arg;
+
+#ifdef __QNX__
+	struct sigevent event;
+	struct sched_param param;
+	int policy;
+
+	// Deliver the expiry as a pulse carrying the timer index, at a priority
+	// just above the registering (proxy scheduler) thread.
+	pthread_getschedparam(pthread_self(), &policy, &param);
+	SIGEV_PULSE_INIT(&event, connectionID, param.sched_priority + 1, PULSE_CODE_TIMER, index);
+	if (timer_create(CLOCK_MONOTONIC, &event, &entry.timerID) != 0)
+	{
+		return -1;
+	}
+#else
+	struct epoll_event event;
+
+	entry.fd = timerfd_create(CLOCK_MONOTONIC, 0);
+	if (entry.fd < 0)
+	{
+		return -1;
+	}
+	event.events = EPOLLIN;
+	event.data.u32 = index;
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, entry.fd, &event);
+#endif
+
+	timers.push_back(entry);
+	return index;
+}
+
+/**
+ * Arm every registered timer relative to the same instant.
+ */
+void TimerDispatcher::arm()
+{
+	arm(currentTime());
+}
+
+/**
+ * Arm every registered timer relative to a given instant (so the timers
+ * of several dispatchers share one phase).
+ *
+ * @param base - the instant on the monotonic clock in nanoseconds
+ */
+void TimerDispatcher::arm(uint64_t base)
+{
+	struct itimerspec spec;
+
+	// Use absolute expiry times so every timer is phase-aligned.
+	for (vector<TimerEntry>::iterator itr = timers.begin(); itr != timers.end(); itr++)
+	{
+		toTimespec(&spec.it_value, base + (*itr).initial);
+		toTimespec(&spec.it_interval, (*itr).interval);
+#ifdef __QNX__
+		timer_settime((*itr).timerID, TIMER_ABSTIME, &spec, NULL);
+#else
+		timerfd_settime((*itr).fd, TFD_TIMER_ABSTIME, &spec, NULL);
+#endif
+	}
+}
+
+/**
+ * Read the monotonic clock the timers are armed against.
+ *
+ * @return the current time in nanoseconds
+ */
+uint64_t TimerDispatcher::currentTime()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * NS_PER_SEC) + now.tv_nsec;
+}
+
+/**
+ * Disarm every timer and terminate the dispatcher thread.
+ */
+void TimerDispatcher::stop()
+{
+	struct itimerspec spec;
+
+	// Disarm first so no further callbacks are queued.
+	toTimespec(&spec.it_value, 0);
+	toTimespec(&spec.it_interval, 0);
+	for (vector<TimerEntry>::iterator itr = timers.begin(); itr != timers.end(); itr++)
+	{
+#ifdef __QNX__
+		timer_settime((*itr).timerID, 0, &spec, NULL);
+#else
+		timerfd_settime((*itr).fd, 0, &spec, NULL);
+#endif
+	}
+
+	// Then wake the dispatcher thread up so it can exit.
+	dispatching = false;
+#ifdef __QNX__
+	MsgSendPulse(connectionID, -1, PULSE_CODE_STOP, 0);
+#else
+	uint64_t value = 1;
+	write(stopFd, &value, sizeof(value));
+#endif
+}
+
+/**
+ * The start routine that is executed when the client calls start().
+ */
+void* TimerDispatcher::startRoutine()
+{
+	while (dispatching)
+	{
+#ifdef __QNX__
+		struct _pulse pulse;
+
+		// Block until the next timer (or stop) pulse arrives.
+		if (MsgReceivePulse(channelID, &pulse, sizeof(pulse), NULL) != 0)
+		{
+			continue;
+		}
+		if (pulse.code == PULSE_CODE_TIMER && dispatching)
+		{
+			TimerEntry& entry = timers[pulse.value.sival_int];
+			entry.callback(entry.arg);
+		}
+#else
+		struct epoll_event events[MAX_EVENTS];
+		uint64_t expirations;
+		int count;
+
+		// Block until at least one timer (or the stop event) fires.
+		count = epoll_wait(epollFd, events, MAX_EVENTS, -1);
+		for (int i = 0; i < count && dispatching; i++)
+		{
+			if (events[i].data.u32 == STOP_TOKEN)
+			{
+				continue;
+			}
+
+			// Invoke the callback once per expiry, including overruns.
+			TimerEntry& entry = timers[events[i].data.u32];
+			if (read(entry.fd, &expirations, sizeof(expirations)) == sizeof(expirations))
+			{
+				while (expirations-- > 0)
+				{
+					entry.callback(entry.arg);
+				}
+			}
+		}
+#endif
+	}
+
+	return NULL;
+}
+
+/**
+ * Fill a timespec from a nanosecond count.
+ *
+ * @param ts - the timespec to fill
+ * @param ns - time in nanoseconds
+ */
+void TimerDispatcher::toTimespec(struct timespec* ts, uint64_t ns)
+{
+	ts->tv_sec = ns / NS_PER_SEC;
+	ts->tv_nsec = ns % NS_PER_SEC;
+}
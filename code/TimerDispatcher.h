@@ -0,0 +1,136 @@
+//*****************************************************************
+// TimerDispatcher.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TIMERDISPATCHER_H_
+#define TIMERDISPATCHER_H_
+
+// Module includes
+#include "Thread.h"
+#include "Project1.h"
+
+// Function invoked on the dispatcher thread when a timer expires
+typedef void (*TimerCallback)(void* arg);
+
+/**
+ * This class owns every timer used during a schedule test (the task
+ * period timers and the test duration timer) and services all of them
+ * from a single high priority thread, instead of letting the OS spawn a
+ * notifier thread per expiry. On Linux each timer is a timerfd polled
+ * with epoll; on QNX each timer delivers a pulse to a private channel.
+ */
+class TimerDispatcher : public Thread
+{
+public:
+	/**
+	 * Default constructor that creates the (empty) dispatcher.
+	 */
+	TimerDispatcher();
+
+	/**
+	 * Default destructor that destroys every timer.
+	 */
+	virtual ~TimerDispatcher();
+
+	/**
+	 * Register a new (disarmed) timer. Must be called before arm().
+	 *
+	 * @param initial - time from arm() until the first expiry in nanoseconds
+	 * @param interval - time between subsequent expiries in nanoseconds
+	 *                   (0 for a one-shot timer)
+	 * @param callback - the function invoked on every expiry
+	 * @param arg - the argument passed to the callback
+	 * @return the timer index, or -1 if the timer could not be created
+	 */
+	int addTimer(uint64_t initial, uint64_t interval, TimerCallback callback, void* arg);
+
+	/**
+	 * Arm every registered timer relative to the same instant.
+	 */
+	void arm();
+
+	/**
+	 * Arm every registered timer relative to a given instant (so the timers
+	 * of several dispatchers share one phase).
+	 *
+	 * @param base - the instant on the monotonic clock in nanoseconds
+	 */
+	void arm(uint64_t base);
+
+	/**
+	 * Read the monotonic clock the timers are armed against.
+	 *
+	 * @return the current time in nanoseconds
+	 */
+	static uint64_t currentTime();
+
+	/**
+	 * Disarm every timer and terminate the dispatcher thread.
+	 */
+	void stop();
+
+protected:
+	/**
+	 * The start routine that is executed when the client calls start().
+	 */
+	void* startRoutine();
+
+private:
+	// A single registered timer
+	typedef struct
+	{
+		uint64_t initial;
+		uint64_t interval;
+		TimerCallback callback;
+		void* arg;
+#ifdef __QNX__
+		timer_t timerID;
+#else
+		int fd;
+#endif
+	} TimerEntry;
+
+	/**
+	 * Fill a timespec from a nanosecond count.
+	 *
+	 * @param ts - the timespec to fill
+	 * @param ns - time in nanoseconds
+	 */
+	static void toTimespec(struct timespec* ts, uint64_t ns);
+
+	// The registered timers
+	vector<TimerEntry> timers;
+
+	// Boolean flag indicating whether the dispatcher loop should keep running.
+	volatile bool dispatching;
+
+#ifdef __QNX__
+	// Channel (and connection to it) that timer pulses are delivered to
+	int channelID;
+	int connectionID;
+#else
+	// epoll instance watching every timerfd, and the eventfd used by stop()
+	int epollFd;
+	int stopFd;
+#endif
+
+#ifdef __QNX__
+	// Pulse codes of the dispatcher's wakeups
+	static const int PULSE_CODE_TIMER = _PULSE_CODE_MINAVAIL;
+	static const int PULSE_CODE_STOP = _PULSE_CODE_MINAVAIL + 1;
+#else
+	// epoll token of the stop wakeup (timers use their index)
+	static const uint32_t STOP_TOKEN = 0xFFFFFFFF;
+#endif
+
+	// Maximum number of expiries serviced per wakeup
+	static const int MAX_EVENTS = 64;
+};
+
+#endif /* TIMERDISPATCHER_H_ */
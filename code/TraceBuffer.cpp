@@ -0,0 +1,160 @@
+//*****************************************************************
+// TraceBuffer.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TraceBuffer.h"
+#include <cstdio>
+#include <cstring>
+
+/**
+ * Default constructor for an empty (zero capacity) buffer.
+ */
+TraceBuffer::TraceBuffer()
+{
+	records = NULL;
+	capacity = 0;
+	writeIndex = 0;
+	dropped = 0;
+}
+
+/**
+ * Default destructor that frees the record storage.
+ */
+TraceBuffer::~TraceBuffer()
+{
+	delete[] records;
+}
+
+/**
+ * Discard every record and (re)allocate storage for the given number
+ * of records. The storage is touched up front so recording never
+ * page faults. Must not be called while producers are active.
+ *
+ * @param capacity - the maximum number of records
+ */
+void TraceBuffer::reset(unsigned int capacity)
+{
+	if (capacity > MAX_CAPACITY)
+	{
+		capacity = MAX_CAPACITY;
+	}
+
+	if (capacity != this->capacity)
+	{
+		delete[] records;
+		records = new TraceRecord[capacity];
+		this->capacity = capacity;
+	}
+	memset(records, 0, capacity * sizeof(TraceRecord));
+
+	writeIndex = 0;
+	dropped = 0;
+}
+
+/**
+ * Retrieve the number of records that were reserved (and fit).
+ *
+ * @return number of records in the buffer
+ */
+unsigned int TraceBuffer::size() const
+{
+	return (writeIndex < capacity) ? writeIndex : capacity;
+}
+
+/**
+ * Retrieve a record by index.
+ *
+ * @param index - record index (0 is the oldest)
+ * @return the record
+ */
+const TraceRecord& TraceBuffer::at(unsigned int index) const
+{
+	return records[index];
+}
+
+/**
+ * Retrieve the number of records dropped because the buffer was full.
+ *
+ * @return number of dropped records
+ */
+unsigned int TraceBuffer::droppedRecords() const
+{
+	return dropped;
+}
+
+/**
+ * Append the task ID of every committed schedule event to a
+ * comma-separated trace string.
+ *
+ * @param trace - the string to append to
+ */
+void TraceBuffer::formatSchedule(string& trace) const
+{
+	char stringHolder[16];
+	unsigned int count = size();
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		if (records[i].committed && records[i].type == EVENT_SCHEDULE)
+		{
+			sprintf(stringHolder, "%u", records[i].taskID);
+			trace.append(stringHolder);
+			trace.append(",");
+		}
+	}
+}
+
+/**
+ * Append the task ID of every committed schedule event of a subset
+ * of the tasks (e.g. one CPU partition) to a comma-separated trace string.
+ *
+ * @param trace - the string to append to
+ * @param members - flags indexed by task ID selecting the tasks to include
+ */
+void TraceBuffer::formatSchedule(string& trace, const vector<bool>& members) const
+{
+	char stringHolder[16];
+	unsigned int count = size();
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		if (records[i].committed && records[i].type == EVENT_SCHEDULE &&
+				records[i].taskID < members.size() && members[records[i].taskID])
+		{
+			sprintf(stringHolder, "%u", records[i].taskID);
+			trace.append(stringHolder);
+			trace.append(",");
+		}
+	}
+}
+
+/**
+ * Estimate the capacity needed to trace a whole schedule test, allowing
+ * for a few dispatches (preemptions) per compute cycle.
+ *
+ * @param taskSet - the collection of task compute/period pairs
+ * @param runtime - the test duration in seconds
+ * @return the number of records to reserve
+ */
+unsigned int TraceBuffer::estimateCapacity(const vector<TaskData>& taskSet, uint64_t runtime)
+{
+	uint64_t cycles = 0;
+
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		if ((*itr).periodTime > 0)
+		{
+			cycles += ((runtime * 1000) / (*itr).periodTime) + 1;
+		}
+	}
+
+	cycles *= RECORDS_PER_CYCLE;
+	return (cycles > MAX_CAPACITY) ? MAX_CAPACITY : (unsigned int)cycles;
+}
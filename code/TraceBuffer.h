@@ -0,0 +1,145 @@
+//*****************************************************************
+// TraceBuffer.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TRACEBUFFER_H_
+#define TRACEBUFFER_H_
+
+// Module includes
+#include "Project1.h"
+
+// A single fixed-size schedule trace record
+typedef struct
+{
+	uint64_t timestamp;     // cycle counter value when the event occurred
+	uint32_t taskID;        // the task the event applies to
+	uint16_t type;          // the event type (EventType)
+	volatile uint16_t committed; // non-zero once the record is fully written
+} TraceRecord;
+
+/**
+ * This class is a preallocated, lock-free multi-producer schedule trace.
+ * Producers (the task threads) reserve a record with a single atomic
+ * increment and fill it in place, so recording an event costs a few
+ * stores and never allocates or blocks. Once the buffer is full further
+ * records are dropped (and counted), which bounds memory for long runs.
+ * The consumer drains the records after the test, in reservation order.
+ */
+class TraceBuffer
+{
+public:
+	/**
+	 * Default constructor for an empty (zero capacity) buffer.
+	 */
+	TraceBuffer();
+
+	/**
+	 * Default destructor that frees the record storage.
+	 */
+	virtual ~TraceBuffer();
+
+	/**
+	 * Discard every record and (re)allocate storage for the given number
+	 * of records. The storage is touched up front so recording never
+	 * page faults. Must not be called while producers are active.
+	 *
+	 * @param capacity - the maximum number of records
+	 */
+	void reset(unsigned int capacity);
+
+	/**
+	 * Append a record to the trace (safe to call from any thread).
+	 *
+	 * @param type - the event type
+	 * @param taskID - the task the event applies to
+	 * @param timestamp - cycle counter value when the event occurred
+	 */
+	inline void record(EventType type, unsigned int taskID, uint64_t timestamp)
+	{
+		unsigned int index = __sync_fetch_and_add(&writeIndex, 1);
+		if (index >= capacity)
+		{
+			__sync_fetch_and_add(&dropped, 1);
+			return;
+		}
+
+		TraceRecord& entry = records[index];
+		entry.timestamp = timestamp;
+		entry.taskID = taskID;
+		entry.type = type;
+		__sync_synchronize(); // publish the fields before the commit flag
+		entry.committed = 1;
+	}
+
+	/**
+	 * Retrieve the number of records that were reserved (and fit).
+	 *
+	 * @return number of records in the buffer
+	 */
+	unsigned int size() const;
+
+	/**
+	 * Retrieve a record by index.
+	 *
+	 * @param index - record index (0 is the oldest)
+	 * @return the record
+	 */
+	const TraceRecord& at(unsigned int index) const;
+
+	/**
+	 * Retrieve the number of records dropped because the buffer was full.
+	 *
+	 * @return number of dropped records
+	 */
+	unsigned int droppedRecords() const;
+
+	/**
+	 * Append the task ID of every committed schedule event to a
+	 * comma-separated trace string.
+	 *
+	 * @param trace - the string to append to
+	 */
+	void formatSchedule(string& trace) const;
+
+	/**
+	 * Append the task ID of every committed schedule event of a subset
+	 * of the tasks (e.g. one CPU partition) to a comma-separated trace string.
+	 *
+	 * @param trace - the string to append to
+	 * @param members - flags indexed by task ID selecting the tasks to include
+	 */
+	void formatSchedule(string& trace, const vector<bool>& members) const;
+
+	/**
+	 * Estimate the capacity needed to trace a whole schedule test, allowing
+	 * for a few dispatches (preemptions) per compute cycle.
+	 *
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param runtime - the test duration in seconds
+	 * @return the number of records to reserve
+	 */
+	static unsigned int estimateCapacity(const vector<TaskData>& taskSet, uint64_t runtime);
+
+private:
+	// Record storage
+	TraceRecord* records;
+	unsigned int capacity;
+
+	// Index of the next record to reserve, and the count of dropped records
+	volatile unsigned int writeIndex;
+	volatile unsigned int dropped;
+
+	// Number of records reserved per expected compute cycle
+	static const unsigned int RECORDS_PER_CYCLE = 4;
+
+	// Upper bound on the buffer size (16 bytes per record)
+	static const unsigned int MAX_CAPACITY = 1 << 22;
+};
+
+#endif /* TRACEBUFFER_H_ */
@@ -0,0 +1,122 @@
+//*****************************************************************
+// TraceFile.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TraceFile.h"
+
+/**
+ * Write every committed record of a trace buffer to a binary trace file.
+ *
+ * @param path - the file to create (or truncate)
+ * @param alg - the algorithm used for the test
+ * @param taskSet - the collection of task compute/period pairs
+ * @param runtime - the test duration in seconds
+ * @param cps - the cycle counter rate of the record timestamps
+ * @param trace - the trace buffer to write
+ * @return true on success, false if the file could not be written
+ */
+bool TraceFile::write(const char* path, AlgorithmType alg, const vector<TaskData>& taskSet,
+		uint64_t runtime, uint64_t cps, const TraceBuffer& trace)
+{
+	FILE* file;
+	uint64_t count = 0;
+	uint64_t base = 0;
+	uint64_t previous;
+	int64_t delta;
+	bool success;
+
+	file = fopen(path, "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	// Count the committed records and find the base timestamp
+	for (unsigned int i = 0; i < trace.size(); i++)
+	{
+		if (trace.at(i).committed)
+		{
+			if (count == 0)
+			{
+				base = trace.at(i).timestamp;
+			}
+			count++;
+		}
+	}
+
+	// Write the header and the task set
+	fwrite(TRACE_FILE_MAGIC, 1, 4, file);
+	putFixed(file, TRACE_FILE_VERSION, 2);
+	putFixed(file, alg, 2);
+	putFixed(file, taskSet.size(), 4);
+	putFixed(file, trace.droppedRecords(), 4);
+	putFixed(file, cps, 8);
+	putFixed(file, runtime, 8);
+	putFixed(file, count, 8);
+	putFixed(file, base, 8);
+	for (vector<TaskData>::const_iterator itr = taskSet.begin(); itr != taskSet.end(); itr++)
+	{
+		putFixed(file, (*itr).computeTime, 4);
+		putFixed(file, (*itr).periodTime, 4);
+	}
+
+	// Write the delta-encoded records. Producers may commit slightly out of
+	// timestamp order, so the delta is signed (zigzag encoded).
+	previous = base;
+	for (unsigned int i = 0; i < trace.size(); i++)
+	{
+		const TraceRecord& record = trace.at(i);
+		if (record.committed)
+		{
+			delta = (int64_t)(record.timestamp - previous);
+			putVarint(file, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+			putVarint(file, ((uint64_t)record.taskID << TRACE_FILE_TYPE_BITS) | record.type);
+			previous = record.timestamp;
+		}
+	}
+
+	success = (ferror(file) == 0);
+	if (fclose(file) != 0)
+	{
+		success = false;
+	}
+	return success;
+}
+
+/**
+ * Write a little-endian fixed-width integer.
+ *
+ * @param file - the output file
+ * @param value - the value to write
+ * @param bytes - the field width in bytes
+ */
+void TraceFile::putFixed(FILE* file, uint64_t value, unsigned int bytes)
+{
+	for (unsigned int i = 0; i < bytes; i++)
+	{
+		fputc((int)((value >> (8 * i)) & 0xFF), file);
+	}
+}
+
+/**
+ * Write an unsigned LEB128 varint.
+ *
+ * @param file - the output file
+ * @param value - the value to write
+ */
+void TraceFile::putVarint(FILE* file, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		fputc((int)((value & 0x7F) | 0x80), file);
+		value >>= 7;
+	}
+	fputc((int)value, file);
+}
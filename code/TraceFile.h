@@ -0,0 +1,87 @@
+//*****************************************************************
+// TraceFile.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TRACEFILE_H_
+#define TRACEFILE_H_
+
+// Module includes
+#include "Project1.h"
+#include "TraceBuffer.h"
+
+/*
+ * Binary trace file layout (all fixed-width fields are little-endian):
+ *
+ *   offset  size  field
+ *        0     4  magic ("RTJT")
+ *        4     2  format version
+ *        6     2  algorithm (AlgorithmType)
+ *        8     4  number of tasks (n)
+ *       12     4  number of records dropped while tracing
+ *       16     8  cycles per second
+ *       24     8  test runtime in seconds
+ *       32     8  number of event records
+ *       40     8  base timestamp (cycles)
+ *       48    8n  task set: n x (compute ms, period ms) as 32-bit pairs
+ *   48+8n      -  event records
+ *
+ * Each event record is two unsigned LEB128 varints: the zigzag-encoded
+ * timestamp delta from the previous record (the first is relative to the
+ * base timestamp), then (taskID << TRACE_FILE_TYPE_BITS) | eventType.
+ * A typical record is 3-4 bytes instead of a 16-byte TraceRecord.
+ */
+#define TRACE_FILE_MAGIC       "RTJT"
+#define TRACE_FILE_VERSION     (1)
+#define TRACE_FILE_HEADER_SIZE (48)
+#define TRACE_FILE_TYPE_BITS   (3)
+
+/**
+ * This class writes the contents of a schedule trace buffer to a
+ * compact binary trace file (see the layout above) that can be read
+ * back with the TraceReader class.
+ *
+ * NOTE: ALL METHODS ARE STATIC
+ */
+class TraceFile
+{
+public:
+	/**
+	 * Write every committed record of a trace buffer to a binary trace file.
+	 *
+	 * @param path - the file to create (or truncate)
+	 * @param alg - the algorithm used for the test
+	 * @param taskSet - the collection of task compute/period pairs
+	 * @param runtime - the test duration in seconds
+	 * @param cps - the cycle counter rate of the record timestamps
+	 * @param trace - the trace buffer to write
+	 * @return true on success, false if the file could not be written
+	 */
+	static bool write(const char* path, AlgorithmType alg, const vector<TaskData>& taskSet,
+			uint64_t runtime, uint64_t cps, const TraceBuffer& trace);
+
+private:
+	/**
+	 * Write a little-endian fixed-width integer.
+	 *
+	 * @param file - the output file
+	 * @param value - the value to write
+	 * @param bytes - the field width in bytes
+	 */
+	static void putFixed(FILE* file, uint64_t value, unsigned int bytes);
+
+	/**
+	 * Write an unsigned LEB128 varint.
+	 *
+	 * @param file - the output file
+	 * @param value - the value to write
+	 */
+	static void putVarint(FILE* file, uint64_t value);
+};
+
+#endif /* TRACEFILE_H_ */
@@ -0,0 +1,267 @@
+//*****************************************************************
+// TraceReader.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "TraceReader.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * Default constructor for a reader with no open file.
+ */
+TraceReader::TraceReader()
+{
+	data = NULL;
+	length = 0;
+	algorithm = ALGORITHM_TYPE_RMA;
+	cps = 0;
+	runtime = 0;
+	eventCount = 0;
+	baseTimestamp = 0;
+	dropped = 0;
+	recordStart = 0;
+	position = 0;
+	eventsRead = 0;
+	timestamp = 0;
+}
+
+/**
+ * Default destructor that unmaps the open file (if any).
+ */
+TraceReader::~TraceReader()
+{
+	close();
+}
+
+/**
+ * Map a trace file and parse its header.
+ *
+ * @param path - the file to open
+ * @return true on success, false if the file is missing or malformed
+ */
+bool TraceReader::open(const char* path)
+{
+	struct stat info;
+	void* mapping;
+	unsigned int numTasks;
+	int fd;
+
+	close();
+
+	fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+	if (fstat(fd, &info) != 0 || info.st_size < TRACE_FILE_HEADER_SIZE)
+	{
+		::close(fd);
+		return false;
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+	data = (const unsigned char*)mapping;
+	length = info.st_size;
+
+	// Validate and parse the header
+	numTasks = getFixed(8, 4);
+	if (memcmp(data, TRACE_FILE_MAGIC, 4) != 0 ||
+			getFixed(4, 2) != TRACE_FILE_VERSION ||
+			getFixed(6, 2) >= ALGORITHM_TYPE_LAST_ENTRY ||
+			length < TRACE_FILE_HEADER_SIZE + ((size_t)numTasks * 8))
+	{
+		close();
+		return false;
+	}
+	algorithm = (AlgorithmType)getFixed(6, 2);
+	dropped = getFixed(12, 4);
+	cps = getFixed(16, 8);
+	runtime = getFixed(24, 8);
+	eventCount = getFixed(32, 8);
+	baseTimestamp = getFixed(40, 8);
+
+	for (unsigned int i = 0; i < numTasks; i++)
+	{
+		TaskData task;
+		task.computeTime = getFixed(TRACE_FILE_HEADER_SIZE + (i * 8), 4);
+		task.periodTime = getFixed(TRACE_FILE_HEADER_SIZE + (i * 8) + 4, 4);
+		taskSet.push_back(task);
+	}
+
+	recordStart = TRACE_FILE_HEADER_SIZE + ((size_t)numTasks * 8);
+	rewind();
+	return true;
+}
+
+/**
+ * Unmap the open file (if any).
+ */
+void TraceReader::close()
+{
+	if (data != NULL)
+	{
+		munmap((void*)data, length);
+	}
+	data = NULL;
+	length = 0;
+	taskSet.clear();
+}
+
+/**
+ * Decode the next event record.
+ *
+ * @param record - the record to fill
+ * @return true if a record was read, false at the end of the
+ *         trace (or if the remaining data is truncated)
+ */
+bool TraceReader::next(TraceRecord& record)
+{
+	uint64_t delta;
+	uint64_t tag;
+
+	if (data == NULL || eventsRead >= eventCount)
+	{
+		return false;
+	}
+	if (!getVarint(delta) || !getVarint(tag))
+	{
+		return false;
+	}
+
+	// Undo the zigzag encoding of the signed delta
+	timestamp += (delta >> 1) ^ (0 - (delta & 1));
+	eventsRead++;
+
+	record.timestamp = timestamp;
+	record.taskID = (uint32_t)(tag >> TRACE_FILE_TYPE_BITS);
+	record.type = (uint16_t)(tag & ((1 << TRACE_FILE_TYPE_BITS) - 1));
+	record.committed = 1;
+	return true;
+}
+
+/**
+ * Restart decoding at the first event record.
+ */
+void TraceReader::rewind()
+{
+	position = recordStart;
+	eventsRead = 0;
+	timestamp = baseTimestamp;
+}
+
+/**
+ * Retrieve the algorithm used for the traced test.
+ *
+ * @return the algorithm type
+ */
+AlgorithmType TraceReader::getAlgorithm() const
+{
+	return algorithm;
+}
+
+/**
+ * Retrieve the task set of the traced test.
+ *
+ * @return the collection of task compute/period pairs
+ */
+const vector<TaskData>& TraceReader::getTaskSet() const
+{
+	return taskSet;
+}
+
+/**
+ * Retrieve the cycle counter rate of the record timestamps.
+ *
+ * @return cycles per second
+ */
+uint64_t TraceReader::getCyclesPerSec() const
+{
+	return cps;
+}
+
+/**
+ * Retrieve the duration of the traced test.
+ *
+ * @return runtime in seconds
+ */
+uint64_t TraceReader::getRuntime() const
+{
+	return runtime;
+}
+
+/**
+ * Retrieve the number of event records in the file.
+ *
+ * @return number of records
+ */
+uint64_t TraceReader::getEventCount() const
+{
+	return eventCount;
+}
+
+/**
+ * Retrieve the number of records dropped while tracing.
+ *
+ * @return number of dropped records
+ */
+unsigned int TraceReader::getDroppedRecords() const
+{
+	return dropped;
+}
+
+/**
+ * Read a little-endian fixed-width integer from the mapped file.
+ *
+ * @param offset - the byte offset of the field
+ * @param bytes - the field width in bytes
+ * @return the value
+ */
+uint64_t TraceReader::getFixed(size_t offset, unsigned int bytes) const
+{
+	uint64_t value = 0;
+
+	for (unsigned int i = 0; i < bytes; i++)
+	{
+		value |= (uint64_t)data[offset + i] << (8 * i);
+	}
+	return value;
+}
+
+/**
+ * Decode an unsigned LEB128 varint at the current position.
+ *
+ * @param value - the decoded value
+ * @return true on success, false if the varint is truncated
+ */
+bool TraceReader::getVarint(uint64_t& value)
+{
+	unsigned int shift = 0;
+
+	value = 0;
+	while (position < length && shift < 64)
+	{
+		unsigned char byte = data[position++];
+		value |= (uint64_t)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			return true;
+		}
+		shift += 7;
+	}
+	return false;
+}
@@ -0,0 +1,145 @@
+//*****************************************************************
+// TraceReader.h
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+#ifndef TRACEREADER_H_
+#define TRACEREADER_H_
+
+// Module includes
+#include "Project1.h"
+#include "TraceBuffer.h"
+#include "TraceFile.h"
+
+/**
+ * This class reads a binary trace file written by TraceFile. The file is
+ * memory-mapped, so opening it costs one header parse regardless of its
+ * size and records are decoded on demand, in order, straight out of the
+ * page cache.
+ */
+class TraceReader
+{
+public:
+	/**
+	 * Default constructor for a reader with no open file.
+	 */
+	TraceReader();
+
+	/**
+	 * Default destructor that unmaps the open file (if any).
+	 */
+	virtual ~TraceReader();
+
+	/**
+	 * Map a trace file and parse its header.
+	 *
+	 * @param path - the file to open
+	 * @return true on success, false if the file is missing or malformed
+	 */
+	bool open(const char* path);
+
+	/**
+	 * Unmap the open file (if any).
+	 */
+	void close();
+
+	/**
+	 * Decode the next event record.
+	 *
+	 * @param record - the record to fill
+	 * @return true if a record was read, false at the end of the
+	 *         trace (or if the remaining data is truncated)
+	 */
+	bool next(TraceRecord& record);
+
+	/**
+	 * Restart decoding at the first event record.
+	 */
+	void rewind();
+
+	/**
+	 * Retrieve the algorithm used for the traced test.
+	 *
+	 * @return the algorithm type
+	 */
+	AlgorithmType getAlgorithm() const;
+
+	/**
+	 * Retrieve the task set of the traced test.
+	 *
+	 * @return the collection of task compute/period pairs
+	 */
+	const vector<TaskData>& getTaskSet() const;
+
+	/**
+	 * Retrieve the cycle counter rate of the record timestamps.
+	 *
+	 * @return cycles per second
+	 */
+	uint64_t getCyclesPerSec() const;
+
+	/**
+	 * Retrieve the duration of the traced test.
+	 *
+	 * @return runtime in seconds
+	 */
+	uint64_t getRuntime() const;
+
+	/**
+	 * Retrieve the number of event records in the file.
+	 *
+	 * @return number of records
+	 */
+	uint64_t getEventCount() const;
+
+	/**
+	 * Retrieve the number of records dropped while tracing.
+	 *
+	 * @return number of dropped records
+	 */
+	unsigned int getDroppedRecords() const;
+
+private:
+	// Mapped file contents
+	const unsigned char* data;
+	size_t length;
+
+	// Header fields
+	AlgorithmType algorithm;
+	vector<TaskData> taskSet;
+	uint64_t cps;
+	uint64_t runtime;
+	uint64_t eventCount;
+	uint64_t baseTimestamp;
+	unsigned int dropped;
+
+	// Decoding state
+	size_t recordStart;
+	size_t position;
+	uint64_t eventsRead;
+	uint64_t timestamp;
+
+	/**
+	 * Read a little-endian fixed-width integer from the mapped file.
+	 *
+	 * @param offset - the byte offset of the field
+	 * @param bytes - the field width in bytes
+	 * @return the value
+	 */
+	uint64_t getFixed(size_t offset, unsigned int bytes) const;
+
+	/**
+	 * Decode an unsigned LEB128 varint at the current position.
+	 *
+	 * @param value - the decoded value
+	 * @return true on success, false if the varint is truncated
+	 */
+	bool getVarint(uint64_t& value);
+};
+
+#endif /* TRACEREADER_H_ */
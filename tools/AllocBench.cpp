@@ -0,0 +1,250 @@
+//*****************************************************************
+// AllocBench.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/Simulator.h"
+#include "../code/ProxyScheduler.h"
+#include "../code/Platform.h"
+#include "../code/SpinQuantum.h"
+#include <fstream>
+#include <new>
+
+// Clock resolution and proxy scheduler priority offset of a live test
+// (as in Project1)
+#define CLOCK_RESOLUTION (50000)
+#define PRIORITY_OFFSET  (5)
+
+// Number of heap allocations made so far (by any thread)
+static volatile unsigned long allocations = 0;
+
+/**
+ * Count every heap allocation.
+ */
+void* operator new(size_t size)
+{
+	void* block;
+
+	__sync_fetch_and_add(&allocations, 1);
+	block = malloc((size > 0) ? size : 1);
+	if (block == NULL)
+	{
+		throw bad_alloc();
+	}
+	return block;
+}
+
+/**
+ * Count every heap (array) allocation.
+ */
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+/**
+ * Release a block allocated by operator new.
+ */
+void operator delete(void* block) throw()
+{
+	free(block);
+}
+
+/**
+ * Release a block allocated by operator new[].
+ */
+void operator delete[](void* block) throw()
+{
+	free(block);
+}
+
+/**
+ * Simulate a task set (quietly) and count the heap allocations made.
+ *
+ * @param alg - the scheduling algorithm
+ * @param taskSet - the compute/period pairs to simulate
+ * @param runtime - the simulated test duration in seconds
+ * @param events - set to the number of period (schedule) events simulated
+ * @return the number of allocations
+ */
+static unsigned long simulate(AlgorithmType alg, const vector<TaskData>& taskSet, int runtime, unsigned int* events)
+{
+	unsigned long startAllocations = allocations;
+	Simulator* simulator;
+
+	simulator = new Simulator(alg, taskSet, runtime);
+	simulator->run();
+	*events = simulator->getDeadlineEvents();
+	delete simulator;
+
+	return allocations - startAllocations;
+}
+
+/**
+ * Run a live schedule test of a task set (quietly, on CPU 0) and count the
+ * heap allocations made, including those of the proxy scheduler's event
+ * loop, the timer dispatcher and the task threads.
+ *
+ * @param alg - the scheduling algorithm
+ * @param topOnly - true to dispatch only the top tasks (EDF and SCT only)
+ * @param taskSet - the compute/period pairs to run
+ * @param runtime - the test duration in seconds
+ * @param basePriority - the lowest task priority
+ * @param events - set to the number of schedule events handled
+ * @return the number of allocations
+ */
+static unsigned long runLive(AlgorithmType alg, bool topOnly, const vector<TaskData>& taskSet, int runtime,
+		int basePriority, uint64_t* events)
+{
+	unsigned long startAllocations = allocations;
+	ProxyScheduler* scheduler;
+
+	scheduler = new ProxyScheduler(alg, taskSet, runtime, 0);
+	scheduler->setPriority(basePriority);
+	scheduler->setDispatchTopOnly(topOnly);
+	scheduler->setCpu(0);
+	scheduler->setStartPriority(basePriority + taskSet.size() + PRIORITY_OFFSET);
+	scheduler->start();
+	scheduler->join();
+	*events = scheduler->getScheduleEvents();
+	delete scheduler;
+
+	return allocations - startAllocations;
+}
+
+/**
+ * Count the heap allocations made by each schedule event (which should be
+ * none once the test has started). Every task set is simulated for two
+ * durations, so the allocations made at startup and when logging cancel
+ * out and the difference is what the additional events allocated. The
+ * schedule trace is disabled, since its log grows with the test duration.
+ *
+ * With -l the same task set is also run live for two durations with each
+ * algorithm (and with top-only dispatch for EDF and SCT), which covers
+ * the proxy scheduler's event loop (task events, priority changes and
+ * the pause/release path). The live tests need real-time privileges and
+ * take three times the runtime per line.
+ *
+ * Output:
+ *   ADATA algorithm,numTasks,events,allocations,allocationsPerEvent
+ *   LDATA algorithm,topOnly,numTasks,events,allocations,allocationsPerEvent
+ *
+ * Usage: AllocBench [-n tasks] [-r runtime] [-l]
+ *
+ * Build: g++ -o AllocBench AllocBench.cpp ../code/Simulator.cpp ../code/SchedulingAlgorithm.cpp
+ *        ../code/RMAlgorithm.cpp ../code/EDFAlgorithm.cpp ../code/SCTAlgorithm.cpp
+ *        ../code/TaskHeap.cpp ../code/TaskTable.cpp ../code/TaskSelect.cpp ../code/Task.cpp ../code/Thread.cpp
+ *        ../code/ProxyScheduler.cpp ../code/CyclicTable.cpp ../code/TaskPool.cpp
+ *        ../code/TaskEventQueue.cpp ../code/TimerDispatcher.cpp ../code/TraceBuffer.cpp
+ *        ../code/LatencyHistogram.cpp ../code/ReadyMap.cpp ../code/SpinQuantum.cpp ../code/PerfCounters.cpp
+ *        ../code/JobLog.cpp ../code/Platform.cpp -lpthread -lrt
+ */
+int main(int argc, char *argv[])
+{
+	unsigned int numTasks = 32;
+	int runtime = 10;
+	int option = 0;
+	vector<TaskData> taskSet;
+	unsigned long shortAllocations;
+	unsigned long longAllocations;
+	unsigned int shortEvents;
+	unsigned int longEvents;
+	uint64_t shortLiveEvents;
+	uint64_t longLiveEvents;
+	bool live = false;
+	int basePriority;
+	ofstream quiet("/dev/null");
+	streambuf* console;
+	streambuf* errors;
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "n:r:l")) != -1)
+	{
+		switch (option)
+		{
+		case 'n':
+			numTasks = atoi(optarg);
+			break;
+		case 'r':
+			runtime = atoi(optarg);
+			break;
+		case 'l':
+			live = true;
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-n tasks] [-r runtime] [-l]" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (numTasks == 0 || runtime <= 0)
+	{
+		cerr << "Usage: " << argv[0] << " [-n tasks] [-r runtime] [-l]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	// The simulator maps virtual time onto the cycle counter
+	Platform::calibrate();
+	scheduleTrace.reset(0);
+
+	// An overloaded task set with mixed periods, so every algorithm
+	// reorders, preempts and misses deadlines
+	for (unsigned int i = 0; i < numTasks; i++)
+	{
+		TaskData data;
+		data.periodTime = 10 + (i % 7) * 5;
+		data.computeTime = 1 + (i % 3);
+		taskSet.push_back(data);
+	}
+
+	for (int alg = ALGORITHM_TYPE_RMA; alg < ALGORITHM_TYPE_LAST_ENTRY; alg++)
+	{
+		// The simulated tasks log as in a live test (and warn about the dropped
+		// trace); keep only our summary
+		console = cout.rdbuf(quiet.rdbuf());
+		errors = cerr.rdbuf(quiet.rdbuf());
+		shortAllocations = simulate((AlgorithmType)alg, taskSet, runtime, &shortEvents);
+		longAllocations = simulate((AlgorithmType)alg, taskSet, 2 * runtime, &longEvents);
+		cout.rdbuf(console);
+		cerr.rdbuf(errors);
+
+		printf("ADATA %d,%u,%u,%ld,%f\n", alg, numTasks, longEvents - shortEvents,
+				(long)(longAllocations - shortAllocations),
+				(double)(long)(longAllocations - shortAllocations) / (longEvents - shortEvents));
+	}
+
+	if (!live)
+	{
+		return EXIT_SUCCESS;
+	}
+
+	// The live tasks spin for a calibrated time per compute quantum
+	SpinQuantum::calibrate(Task::TIME_QUANTUM, NULL);
+	Platform::setClockResolution(CLOCK_RESOLUTION);
+	basePriority = Platform::basePriority(pthread_self());
+
+	for (int alg = ALGORITHM_TYPE_RMA; alg < ALGORITHM_TYPE_LAST_ENTRY; alg++)
+	{
+		for (int topOnly = 0; topOnly <= ((alg == ALGORITHM_TYPE_RMA) ? 0 : 1); topOnly++)
+		{
+			console = cout.rdbuf(quiet.rdbuf());
+			errors = cerr.rdbuf(quiet.rdbuf());
+			shortAllocations = runLive((AlgorithmType)alg, topOnly, taskSet, runtime, basePriority, &shortLiveEvents);
+			longAllocations = runLive((AlgorithmType)alg, topOnly, taskSet, 2 * runtime, basePriority, &longLiveEvents);
+			cout.rdbuf(console);
+			cerr.rdbuf(errors);
+
+			printf("LDATA %d,%d,%u,%lu,%ld,%f\n", alg, topOnly, numTasks,
+					(unsigned long)(longLiveEvents - shortLiveEvents), (long)(longAllocations - shortAllocations),
+					(double)(long)(longAllocations - shortAllocations) / (longLiveEvents - shortLiveEvents));
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,290 @@
+//*****************************************************************
+// KevAnalyze.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/KevReader.h"
+#include <cstring>
+
+// Per-thread statistics gathered from the kernel thread state events
+typedef struct
+{
+	int taskID;             // task ID learned from EVENT_SCHEDULE (-1 if none)
+	uint64_t runStart;      // when the current run interval began
+	uint64_t readySince;    // when the thread was made ready (0 if not waiting)
+	unsigned int runs;      // number of run intervals
+	uint64_t runTime;       // total running time (cycles)
+	uint64_t minRun;
+	uint64_t maxRun;
+	unsigned int preemptions; // running -> ready transitions
+	unsigned int latencies;   // ready -> running transitions after a wakeup
+	uint64_t latencyTime;
+	uint64_t minLatency;
+	uint64_t maxLatency;
+} ThreadStats;
+
+// Per-task counts taken from our own user events
+typedef struct
+{
+	unsigned int scheduled;
+	unsigned int missed;
+} TaskCounts;
+
+// Analysis state
+static map<uint64_t, ThreadStats> threads;
+static map<unsigned int, TaskCounts> taskCounts;
+static map<unsigned int, uint64_t> running; // CPU -> running thread
+static unsigned int contextSwitches = 0;
+
+/**
+ * Retrieve (creating if needed) the statistics of a thread.
+ *
+ * @param key - the thread key (pid << 32 | tid)
+ * @return the thread statistics
+ */
+static ThreadStats& threadStats(uint64_t key)
+{
+	map<uint64_t, ThreadStats>::iterator itr = threads.find(key);
+
+	if (itr == threads.end())
+	{
+		ThreadStats stats;
+		memset(&stats, 0, sizeof(stats));
+		stats.taskID = -1;
+		itr = threads.insert(make_pair(key, stats)).first;
+	}
+	return itr->second;
+}
+
+/**
+ * Close the run interval of the thread running on a CPU (if any).
+ *
+ * @param cpu - the CPU
+ * @param now - the current time
+ */
+static void stopRunning(unsigned int cpu, uint64_t now)
+{
+	map<unsigned int, uint64_t>::iterator itr = running.find(cpu);
+	uint64_t length;
+
+	if (itr == running.end())
+	{
+		return;
+	}
+
+	ThreadStats& stats = threadStats(itr->second);
+	length = now - stats.runStart;
+	if (stats.runs == 0 || length < stats.minRun)
+	{
+		stats.minRun = length;
+	}
+	if (length > stats.maxRun)
+	{
+		stats.maxRun = length;
+	}
+	stats.runs++;
+	stats.runTime += length;
+	running.erase(itr);
+}
+
+/**
+ * Apply a thread state change.
+ *
+ * @param event - the thread event
+ */
+static void threadEvent(const KevEvent& event)
+{
+	uint64_t key = ((uint64_t)event.data[0] << 32) | event.data[1];
+	map<unsigned int, uint64_t>::iterator current = running.find(event.cpu);
+	bool wasRunning = (current != running.end() && current->second == key);
+	ThreadStats& stats = threadStats(key);
+
+	switch (event.event)
+	{
+	case KEV_THREAD_RUNNING:
+		if (wasRunning)
+		{
+			break;
+		}
+		if (current != running.end())
+		{
+			stopRunning(event.cpu, event.timestamp);
+		}
+		contextSwitches++;
+
+		// Wakeup (preemption) latency: made ready until actually running
+		if (stats.readySince != 0)
+		{
+			uint64_t latency = event.timestamp - stats.readySince;
+			if (stats.latencies == 0 || latency < stats.minLatency)
+			{
+				stats.minLatency = latency;
+			}
+			if (latency > stats.maxLatency)
+			{
+				stats.maxLatency = latency;
+			}
+			stats.latencies++;
+			stats.latencyTime += latency;
+			stats.readySince = 0;
+		}
+		stats.runStart = event.timestamp;
+		running[event.cpu] = key;
+		break;
+	case KEV_THREAD_READY:
+		if (wasRunning)
+		{
+			// Preempted: waiting again is not a wakeup
+			stopRunning(event.cpu, event.timestamp);
+			stats.preemptions++;
+			stats.readySince = 0;
+		}
+		else
+		{
+			stats.readySince = event.timestamp;
+		}
+		break;
+	case KEV_THREAD_CREATE:
+	case KEV_THREAD_DESTROY:
+		break;
+	default:
+		// Any other state blocks the thread
+		if (wasRunning)
+		{
+			stopRunning(event.cpu, event.timestamp);
+		}
+		stats.readySince = 0;
+		break;
+	}
+}
+
+/**
+ * Apply one of our own user events.
+ *
+ * @param event - the user event
+ */
+static void userEvent(const KevEvent& event)
+{
+	map<unsigned int, uint64_t>::iterator current;
+
+	switch (event.event)
+	{
+	case EVENT_SCHEDULE:
+		// The task logs its schedule event itself, so the running thread is the task
+		taskCounts[event.data[1]].scheduled++;
+		current = running.find(event.cpu);
+		if (current != running.end())
+		{
+			threadStats(current->second).taskID = event.data[1];
+		}
+		break;
+	case EVENT_MISSED_DEADLINE:
+		taskCounts[event.data[1]].missed++;
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * Analyze a QNX kernel trace of a schedule test: count context switches
+ * and, for every task thread, compare the schedule events it logged with
+ * the run intervals the kernel actually gave it, and measure its wakeup
+ * (preemption) latency from being made ready until it ran.
+ *
+ * Output (times in microseconds):
+ *   KEV cps,events,duration
+ *   SWITCHES count
+ *   KDATA task,pid,tid,scheduled,missed,runs,runTime,minRun,avgRun,maxRun,
+ *         preemptions,wakeups,minLatency,avgLatency,maxLatency
+ *
+ * Usage: KevAnalyze file.kev
+ *
+ * Build: g++ -o KevAnalyze KevAnalyze.cpp ../code/KevReader.cpp
+ */
+int main(int argc, char *argv[])
+{
+	KevReader reader;
+	KevEvent event;
+	uint64_t first = 0;
+	uint64_t last = 0;
+	bool haveFirst = false;
+	double usPerCycle;
+
+	if (argc != 2)
+	{
+		cerr << "Usage: " << argv[0] << " file.kev" << endl;
+		return EXIT_FAILURE;
+	}
+	if (!reader.open(argv[1]))
+	{
+		cerr << "Error reading trace file " << argv[1] << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Stream the events (only simple events matter here). Each buffer
+	// starts with control events, so they do not bound the duration.
+	while (reader.next(event))
+	{
+		if (event.structure != KEV_STRUCT_SIMPLE || event.eventClass == KEV_CLASS_CONTROL)
+		{
+			continue;
+		}
+		if (!haveFirst)
+		{
+			first = event.timestamp;
+			haveFirst = true;
+		}
+		last = event.timestamp;
+
+		if (event.eventClass == KEV_CLASS_THREAD)
+		{
+			threadEvent(event);
+		}
+		else if (event.eventClass == KEV_CLASS_USER)
+		{
+			userEvent(event);
+		}
+	}
+
+	// Close the intervals still open at the end of the trace
+	while (!running.empty())
+	{
+		stopRunning(running.begin()->first, last);
+	}
+
+	usPerCycle = (reader.getCyclesPerSec() > 0) ? (1000000.0 / reader.getCyclesPerSec()) : 0.0;
+	printf("KEV %llu,%llu,%f\n", (unsigned long long)reader.getCyclesPerSec(),
+			(unsigned long long)reader.getEventCount(),
+			(double)(last - first) * usPerCycle / 1000000.0);
+	printf("SWITCHES %u\n", contextSwitches);
+
+	for (map<uint64_t, ThreadStats>::iterator itr = threads.begin(); itr != threads.end(); itr++)
+	{
+		ThreadStats& stats = itr->second;
+		if (stats.taskID < 0)
+		{
+			continue;
+		}
+
+		TaskCounts& counts = taskCounts[stats.taskID];
+		printf("KDATA %d,%u,%u,%u,%u,%u,%f,%f,%f,%f,%u,%u,%f,%f,%f\n",
+				stats.taskID, (unsigned int)(itr->first >> 32), (unsigned int)(itr->first & 0xFFFFFFFF),
+				counts.scheduled, counts.missed, stats.runs,
+				stats.runTime * usPerCycle, stats.minRun * usPerCycle,
+				(stats.runs > 0) ? (stats.runTime * usPerCycle / stats.runs) : 0.0,
+				stats.maxRun * usPerCycle, stats.preemptions, stats.latencies,
+				stats.minLatency * usPerCycle,
+				(stats.latencies > 0) ? (stats.latencyTime * usPerCycle / stats.latencies) : 0.0,
+				stats.maxLatency * usPerCycle);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+//*****************************************************************
+// MultiCoreBench.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/ResultsTable.h"
+#include "../code/Partitioner.h"
+#include "../code/Simulator.h"
+#include "../code/ProxyScheduler.h"
+#include "../code/Platform.h"
+#include <fstream>
+
+// Outcome of simulating one task set on several CPUs
+typedef struct
+{
+	unsigned int missed;
+	unsigned int deadlineEvents;
+	unsigned int preemptions;
+	unsigned int migrations;
+} BenchResult;
+
+/**
+ * Simulate a task set (quietly) and accumulate its outcome.
+ *
+ * @param alg - the scheduling algorithm
+ * @param taskSet - the compute/period pairs to simulate
+ * @param runtime - the simulated test duration in seconds
+ * @param taskIDs - the (global) ID of each task
+ * @param cpus - the number of CPUs the task set is globally scheduled on
+ * @param result - the outcome to accumulate into
+ */
+static void simulate(AlgorithmType alg, const vector<TaskData>& taskSet, int runtime,
+		const vector<unsigned int>& taskIDs, unsigned int cpus, BenchResult& result)
+{
+	Simulator* simulator;
+
+	scheduleTrace.reset(TraceBuffer::estimateCapacity(taskSet, runtime));
+	simulator = new Simulator(alg, taskSet, runtime, taskIDs, cpus);
+	simulator->run();
+	result.missed += simulator->getMissedDeadlines();
+	result.deadlineEvents += simulator->getDeadlineEvents();
+	result.preemptions += simulator->getPreemptions();
+	result.migrations += simulator->getMigrations();
+	delete simulator;
+}
+
+/**
+ * Re-run the task sets of a results table (see ResultsIngest) in virtual
+ * time on several CPUs, once partitioned (first fit decreasing, one
+ * scheduler per CPU) and once globally (the highest priority tasks run on
+ * any CPU), with the algorithm each experiment was originally run with.
+ * The benchmark is virtual time only: it measures schedulability, not
+ * scheduling overhead (run Project1 with -p or -g for that on real CPUs).
+ *
+ * Output:
+ *   MDATA source,algorithm,numTasks,utilization,cpus,deadlineEvents,
+ *         partitionedMissed,partitionedPreemptions,
+ *         globalMissed,globalPreemptions,globalMigrations
+ *   MTOTAL algorithm,experiments,partitionedMissRatio,globalMissRatio
+ *
+ * Usage: MultiCoreBench [-c cpus] table.bin
+ *
+ * Build: g++ -o MultiCoreBench MultiCoreBench.cpp ../code/ResultsTable.cpp ../code/Partitioner.cpp
+ *        ../code/Schedulability.cpp
+ *        ../code/Simulator.cpp ../code/SchedulingAlgorithm.cpp ../code/RMAlgorithm.cpp
+ *        ../code/EDFAlgorithm.cpp ../code/SCTAlgorithm.cpp ../code/TaskHeap.cpp ../code/TaskTable.cpp ../code/Task.cpp
+ *        ../code/TaskSelect.cpp ../code/Thread.cpp ../code/ProxyScheduler.cpp ../code/CyclicTable.cpp ../code/TaskPool.cpp
+ *        ../code/TaskEventQueue.cpp ../code/TimerDispatcher.cpp ../code/TraceBuffer.cpp ../code/LatencyHistogram.cpp
+ *        ../code/ReadyMap.cpp ../code/SpinQuantum.cpp ../code/PerfCounters.cpp ../code/JobLog.cpp ../code/Platform.cpp -lpthread -lrt
+ */
+int main(int argc, char *argv[])
+{
+	ResultsTable table;
+	unsigned int numCpus = 2;
+	int option = 0;
+	vector<TaskData> taskSet;
+	vector<TaskData> partitionTasks;
+	vector<unsigned int> taskIDs;
+	vector<Partition> partitions;
+	map<unsigned int, BenchResult> totals[2]; // partitioned, global
+	map<unsigned int, unsigned int> experiments;
+	ofstream quiet("/dev/null");
+	streambuf* console;
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "c:")) != -1)
+	{
+		switch (option)
+		{
+		case 'c':
+			numCpus = atoi(optarg);
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-c cpus] table.bin" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (numCpus == 0 || optind >= argc || !table.open(argv[optind]))
+	{
+		cerr << "Usage: " << argv[0] << " [-c cpus] table.bin" << endl;
+		return EXIT_FAILURE;
+	}
+
+	const uint32_t* source = table.getUint32Column(EXP_SOURCE);
+	const uint32_t* algorithm = table.getUint32Column(EXP_ALGORITHM);
+	const uint32_t* runtime = table.getUint32Column(EXP_RUNTIME);
+	const uint32_t* firstTask = table.getUint32Column(EXP_FIRST_TASK);
+	const uint32_t* taskRows = table.getUint32Column(EXP_TASK_ROWS);
+	const double* utilization = table.getDoubleColumn(EXP_UTILIZATION);
+	const uint32_t* compute = table.getUint32Column(TASK_COMPUTE);
+	const uint32_t* period = table.getUint32Column(TASK_PERIOD);
+
+	// The simulator maps virtual time onto the cycle counter
+	Platform::calibrate();
+
+	for (unsigned int row = 0; row < table.getExperimentCount(); row++)
+	{
+		BenchResult partitioned = {0, 0, 0, 0};
+		BenchResult global = {0, 0, 0, 0};
+		AlgorithmType alg = (AlgorithmType)algorithm[row];
+
+		if (taskRows[row] == 0 || algorithm[row] >= ALGORITHM_TYPE_LAST_ENTRY)
+		{
+			continue;
+		}
+
+		// Rebuild the task set (skipping logs whose task data is incomplete)
+		taskSet.clear();
+		taskIDs.clear();
+		for (unsigned int t = firstTask[row]; t < firstTask[row] + taskRows[row]; t++)
+		{
+			TaskData data;
+			data.computeTime = compute[t];
+			data.periodTime = period[t];
+			taskSet.push_back(data);
+			taskIDs.push_back(taskIDs.size());
+			if (period[t] == 0 || compute[t] > period[t])
+			{
+				taskSet.clear();
+				break;
+			}
+		}
+		if (taskSet.empty())
+		{
+			continue;
+		}
+
+		// The simulated tasks log to stdout as in a live test; keep only our summary
+		console = cout.rdbuf(quiet.rdbuf());
+
+		// Partitioned: each CPU simulates its own tasks
+		Partitioner::assign(taskSet, alg, numCpus, PACKING_FIRST_FIT, partitions);
+		for (vector<Partition>::iterator itr = partitions.begin(); itr != partitions.end(); itr++)
+		{
+			if (!(*itr).taskIDs.empty())
+			{
+				Partitioner::subset(taskSet, *itr, partitionTasks);
+				simulate(alg, partitionTasks, runtime[row], (*itr).taskIDs, 1, partitioned);
+			}
+		}
+
+		// Global: one scheduler for every CPU
+		simulate(alg, taskSet, runtime[row], taskIDs, numCpus, global);
+
+		cout.rdbuf(console);
+
+		printf("MDATA %s,%u,%u,%f,%u,%u,%u,%u,%u,%u,%u\n", table.getSources()[source[row]].c_str(),
+				algorithm[row], taskRows[row], utilization[row], numCpus, global.deadlineEvents,
+				partitioned.missed, partitioned.preemptions,
+				global.missed, global.preemptions, global.migrations);
+
+		BenchResult& partitionedTotal = totals[0][algorithm[row]];
+		BenchResult& globalTotal = totals[1][algorithm[row]];
+		partitionedTotal.missed += partitioned.missed;
+		partitionedTotal.deadlineEvents += partitioned.deadlineEvents;
+		globalTotal.missed += global.missed;
+		globalTotal.deadlineEvents += global.deadlineEvents;
+		experiments[algorithm[row]]++;
+	}
+
+	for (map<unsigned int, unsigned int>::iterator itr = experiments.begin(); itr != experiments.end(); itr++)
+	{
+		BenchResult& partitionedTotal = totals[0][itr->first];
+		BenchResult& globalTotal = totals[1][itr->first];
+		printf("MTOTAL %u,%u,%f,%f\n", itr->first, itr->second,
+				(partitionedTotal.deadlineEvents > 0) ?
+						((double)partitionedTotal.missed / partitionedTotal.deadlineEvents) : 0.0,
+				(globalTotal.deadlineEvents > 0) ?
+						((double)globalTotal.missed / globalTotal.deadlineEvents) : 0.0);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+//*****************************************************************
+// ResultsIngest.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/ResultsTable.h"
+
+/**
+ * Ingest schedule test logs (e.g. data/EDF_new.txt) into one columnar
+ * results table. Each log is identified by its file name without the
+ * directory and extension (e.g. "EDF_new").
+ *
+ * Usage: ResultsIngest table.bin log.txt [log.txt ...]
+ *
+ * Build: g++ -o ResultsIngest ResultsIngest.cpp ../code/ResultsTable.cpp
+ */
+int main(int argc, char *argv[])
+{
+	ResultsTable table;
+	string source;
+	size_t slash;
+	size_t dot;
+	int added;
+
+	if (argc < 3)
+	{
+		cerr << "Usage: " << argv[0] << " table.bin log.txt [log.txt ...]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	for (int i = 2; i < argc; i++)
+	{
+		// Strip the directory and extension to name the source
+		source = argv[i];
+		slash = source.find_last_of('/');
+		if (slash != string::npos)
+		{
+			source.erase(0, slash + 1);
+		}
+		dot = source.find_last_of('.');
+		if (dot != string::npos)
+		{
+			source.erase(dot);
+		}
+
+		added = table.ingest(argv[i], source);
+		if (added < 0)
+		{
+			cerr << "Error reading log " << argv[i] << endl;
+			return EXIT_FAILURE;
+		}
+		cout << source << ": " << added << " experiments" << endl;
+	}
+
+	if (!table.write(argv[1]))
+	{
+		cerr << "Error writing table " << argv[1] << endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+//*****************************************************************
+// ResultsQuery.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/ResultsTable.h"
+
+// Aggregates of one (source, algorithm, task count) group
+typedef struct
+{
+	unsigned int experiments;
+	double utilization;
+	double schedOverhead;
+	double runtimeError;
+	unsigned int missed;
+	unsigned int deadlineEvents;
+} Aggregate;
+
+/**
+ * Summarize the experiments of a results table grouped by source,
+ * algorithm and task count, optionally restricted to one algorithm,
+ * one task count and/or a utilization interval. For example, the mean
+ * scheduling overhead against n for EDF new vs. old is "-a 1".
+ *
+ * Output (overhead in microseconds):
+ *   QDATA source,algorithm,numTasks,experiments,meanUtilization,
+ *         meanSchedOverhead,meanRuntimeError,missRatio
+ *
+ * Usage: ResultsQuery [-a algorithm] [-n tasks] [-u min:max] table.bin
+ *
+ * Build: g++ -o ResultsQuery ResultsQuery.cpp ../code/ResultsTable.cpp
+ */
+int main(int argc, char *argv[])
+{
+	ResultsTable table;
+	map<string, Aggregate> groups;
+	const ResultsIndexEntry* index;
+	unsigned int entries;
+	int algorithm = -1;
+	int numTasks = -1;
+	double minUtilization = 0;
+	double maxUtilization = 1e9;
+	int option = 0;
+	char key[128];
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "a:n:u:")) != -1)
+	{
+		switch (option)
+		{
+		case 'a':
+			algorithm = atoi(optarg);
+			break;
+		case 'n':
+			numTasks = atoi(optarg);
+			break;
+		case 'u':
+			if (sscanf(optarg, "%lf:%lf", &minUtilization, &maxUtilization) != 2)
+			{
+				cerr << "Invalid utilization interval " << optarg << endl;
+				return EXIT_FAILURE;
+			}
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-a algorithm] [-n tasks] [-u min:max] table.bin" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (optind >= argc || !table.open(argv[optind]))
+	{
+		cerr << "Usage: " << argv[0] << " [-a algorithm] [-n tasks] [-u min:max] table.bin" << endl;
+		return EXIT_FAILURE;
+	}
+
+	const uint32_t* source = table.getUint32Column(EXP_SOURCE);
+	const uint32_t* missed = table.getUint32Column(EXP_MISSED);
+	const uint32_t* firstTask = table.getUint32Column(EXP_FIRST_TASK);
+	const uint32_t* taskRows = table.getUint32Column(EXP_TASK_ROWS);
+	const double* utilization = table.getDoubleColumn(EXP_UTILIZATION);
+	const double* schedOverhead = table.getDoubleColumn(EXP_SCHED_OVERHEAD);
+	const double* runtimeError = table.getDoubleColumn(EXP_RUNTIME_ERROR);
+	const uint32_t* deadlineEvents = table.getUint32Column(TASK_DEADLINE_EVENTS);
+
+	// Walk the matching index groups; each is sorted by utilization
+	index = table.getIndex(entries);
+	for (unsigned int i = 0; i < entries; i++)
+	{
+		unsigned int first = index[i].firstRow;
+		unsigned int rows = index[i].rows;
+
+		if ((algorithm >= 0 && index[i].algorithm != (uint32_t)algorithm) ||
+				(numTasks >= 0 && index[i].numTasks != (uint32_t)numTasks))
+		{
+			continue;
+		}
+		table.narrowUtilization(first, rows, minUtilization, maxUtilization);
+
+		for (unsigned int row = first; row < first + rows; row++)
+		{
+			sprintf(key, "%s,%u,%u", table.getSources()[source[row]].c_str(),
+					index[i].algorithm, index[i].numTasks);
+			Aggregate& aggregate = groups[key];
+			aggregate.experiments++;
+			aggregate.utilization += utilization[row];
+			aggregate.schedOverhead += schedOverhead[row];
+			aggregate.runtimeError += runtimeError[row];
+			aggregate.missed += missed[row];
+			for (unsigned int t = firstTask[row]; t < firstTask[row] + taskRows[row]; t++)
+			{
+				aggregate.deadlineEvents += deadlineEvents[t];
+			}
+		}
+	}
+
+	for (map<string, Aggregate>::iterator itr = groups.begin(); itr != groups.end(); itr++)
+	{
+		Aggregate& aggregate = itr->second;
+		printf("QDATA %s,%u,%f,%f,%f,%f\n", itr->first.c_str(), aggregate.experiments,
+				aggregate.utilization / aggregate.experiments,
+				(aggregate.schedOverhead / aggregate.experiments) * 1000000.0,
+				aggregate.runtimeError / aggregate.experiments,
+				(aggregate.deadlineEvents > 0) ? ((double)aggregate.missed / aggregate.deadlineEvents) : 0.0);
+	}
+
+	return EXIT_SUCCESS;
+}
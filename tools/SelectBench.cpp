@@ -0,0 +1,140 @@
+//*****************************************************************
+// SelectBench.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/TaskSelect.h"
+#include "../code/Platform.h"
+#include <algorithm>
+
+// Orders slots by (key, task ID), as TaskSelect does
+struct SlotOrder
+{
+	const vector<unsigned int>* keys;
+	const vector<unsigned int>* ids;
+
+	bool operator()(unsigned int a, unsigned int b) const
+	{
+		return ((*keys)[a] < (*keys)[b]) || ((*keys)[a] == (*keys)[b] && (*ids)[a] < (*ids)[b]);
+	}
+};
+
+/**
+ * Time the selection of the top k pending tasks out of n with every
+ * kernel the CPU supports, and with a full sort of the pending tasks for
+ * reference, checking each kernel's selection against the sort. The keys
+ * repeat (so ties are broken by task ID) and a quarter of the tasks have
+ * no pending compute cycle.
+ *
+ * Output (time in nanoseconds per selection):
+ *   SDATA numTasks,kernel,k,nsPerSelect,correct
+ *
+ * Usage: SelectBench [-k top]
+ *
+ * Build: g++ -O2 -o SelectBench SelectBench.cpp ../code/TaskSelect.cpp ../code/Platform.cpp -lpthread -lrt
+ */
+int main(int argc, char *argv[])
+{
+	unsigned int k = 1;
+	int option = 0;
+	vector<unsigned int> keys;
+	vector<unsigned int> ids;
+	vector<int> backlogs;
+	vector<unsigned int> sorted;
+	vector<unsigned int> selected;
+	unsigned int found;
+	unsigned int iterations;
+	uint64_t startCycleTime;
+	uint64_t elapsed;
+	bool correct;
+	SlotOrder order;
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "k:")) != -1)
+	{
+		switch (option)
+		{
+		case 'k':
+			k = atoi(optarg);
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-k top]" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (k == 0)
+	{
+		cerr << "Usage: " << argv[0] << " [-k top]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	Platform::calibrate();
+	srand(1);
+	order.keys = &keys;
+	order.ids = &ids;
+
+	for (unsigned int n = 64; n <= 65536; n *= 4)
+	{
+		// Shuffled task IDs, repeating keys and some idle tasks
+		keys.resize(n);
+		ids.resize(n);
+		backlogs.resize(n);
+		for (unsigned int i = 0; i < n; i++)
+		{
+			keys[i] = rand() % (n / 2);
+			ids[i] = i;
+			backlogs[i] = ((rand() % 4) == 0) ? 0 : 1;
+		}
+		random_shuffle(ids.begin(), ids.end());
+		iterations = (n < (1 << 22)) ? ((1 << 22) / n) : 1;
+
+		// Reference: sort every pending task
+		startCycleTime = Platform::clockCycles();
+		for (unsigned int r = 0; r < iterations; r++)
+		{
+			sorted.clear();
+			for (unsigned int i = 0; i < n; i++)
+			{
+				if (backlogs[i] > 0)
+				{
+					sorted.push_back(i);
+				}
+			}
+			sort(sorted.begin(), sorted.end(), order);
+		}
+		elapsed = Platform::clockCycles() - startCycleTime;
+		printf("SDATA %u,sort,%u,%f,1\n", n, k,
+				((double)elapsed * 1000000000.0) / Platform::cyclesPerSec() / iterations);
+
+		for (int kernel = SELECT_KERNEL_SCALAR; kernel < SELECT_KERNEL_LAST_ENTRY; kernel++)
+		{
+			if (!TaskSelect::setKernel((SelectKernel)kernel))
+			{
+				continue;
+			}
+
+			selected.assign(k, 0);
+			found = 0;
+			startCycleTime = Platform::clockCycles();
+			for (unsigned int r = 0; r < iterations; r++)
+			{
+				found = TaskSelect::selectTop(&keys[0], &ids[0], &backlogs[0], n, k, &selected[0]);
+			}
+			elapsed = Platform::clockCycles() - startCycleTime;
+
+			correct = (found == min((unsigned int)sorted.size(), k)) &&
+					equal(selected.begin(), selected.begin() + found, sorted.begin());
+			printf("SDATA %u,%s,%u,%f,%d\n", n, TaskSelect::kernelName((SelectKernel)kernel), k,
+					((double)elapsed * 1000000000.0) / Platform::cyclesPerSec() / iterations, correct);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
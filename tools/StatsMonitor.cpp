@@ -0,0 +1,107 @@
+//*****************************************************************
+// StatsMonitor.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/StatsExport.h"
+
+/**
+ * Sample the live statistics that a running schedule test publishes
+ * (Project1 -x name) at a fixed interval. The monitor waits for a test to
+ * start and follows one test after another (e.g. the experiments of a
+ * batch run) until the sample count is reached.
+ *
+ * Output (one line per proxy scheduler and task per sample; schedule
+ * event time in microseconds, missed compute time in milliseconds):
+ *   LPDATA sample,scheduler,numScheduleEvents,avgScheduleTime
+ *   LTDATA sample,task,deadlineEvents,deadlinesMissed,timeMissed
+ *   LSTOP sample
+ *
+ * Usage: StatsMonitor [-n name] [-i ms] [-c samples]
+ *
+ * Build: g++ -O2 -o StatsMonitor StatsMonitor.cpp ../code/StatsExport.cpp ../code/Platform.cpp -lpthread -lrt
+ */
+int main(int argc, char *argv[])
+{
+	const char* name = "/project1";
+	unsigned int interval = 1000;
+	unsigned int samples = 0;
+	unsigned int sample = 0;
+	int option = 0;
+	StatsExport stats;
+	TaskStatsRecord task;
+	SchedulerStatsRecord scheduler;
+	const StatsHeader* header;
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "n:i:c:")) != -1)
+	{
+		switch (option)
+		{
+		case 'n':
+			name = optarg;
+			break;
+		case 'i':
+			interval = atoi(optarg);
+			break;
+		case 'c':
+			samples = atoi(optarg);
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-n name] [-i ms] [-c samples]" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (interval == 0)
+	{
+		cerr << "Usage: " << argv[0] << " [-n name] [-i ms] [-c samples]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Sample until the count is reached (0 samples forever)
+	while (samples == 0 || sample < samples)
+	{
+		usleep(interval * 1000);
+		if (stats.getHeader() == NULL && !stats.attach(name))
+		{
+			continue; // no test is running yet
+		}
+		header = stats.getHeader();
+
+		for (unsigned int i = 0; i < header->numSchedulers; i++)
+		{
+			if (stats.readScheduler(i, scheduler))
+			{
+				printf("LPDATA %u,%u,%" PRIu64 ",%f\n", sample, i, scheduler.numScheduleEvents,
+						(scheduler.numScheduleEvents == 0) ? 0.0 : ((double)scheduler.realScheduleTime *
+						1000000.0) / header->cyclesPerSec / scheduler.numScheduleEvents);
+			}
+		}
+		for (unsigned int i = 0; i < header->numTasks; i++)
+		{
+			if (stats.readTask(i, task))
+			{
+				printf("LTDATA %u,%u,%u,%u,%f\n", sample, i, task.deadlineEvents, task.deadlinesMissed,
+						task.totalComputationTimeMissed / 1000000.0);
+			}
+		}
+
+		// Wait for the next test once this one is over
+		if (header->active == 0)
+		{
+			printf("LSTOP %u\n", sample);
+			stats.detach();
+		}
+		fflush(stdout);
+		sample++;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+//*****************************************************************
+// TraceDump.cpp
+//
+//  Created on: Oct 16, 2026
+//      Author: Christopher Wood
+//              Vineeth Vijayakumaran
+//
+//  $Id$
+//*****************************************************************
+
+// Module includes
+#include "../code/Project1.h"
+#include "../code/TraceReader.h"
+
+/**
+ * Print the header of a binary trace file followed by one line per
+ * event record ("time_us event task"), or only the comma-separated
+ * schedule trace (the old TRACE line) when -s is given.
+ *
+ * Usage: TraceDump [-s] file
+ *
+ * Build: g++ -o TraceDump TraceDump.cpp ../code/TraceReader.cpp
+ */
+int main(int argc, char *argv[])
+{
+	TraceReader reader;
+	TraceRecord record;
+	bool scheduleOnly = false;
+	int option = 0;
+	uint64_t first = 0;
+	bool haveFirst = false;
+	double usPerCycle;
+
+	// Parse the command line options
+	while ((option = getopt(argc, argv, "s")) != -1)
+	{
+		switch (option)
+		{
+		case 's':
+			scheduleOnly = true;
+			break;
+		default:
+			cerr << "Usage: " << argv[0] << " [-s] file" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if (optind >= argc)
+	{
+		cerr << "Usage: " << argv[0] << " [-s] file" << endl;
+		return EXIT_FAILURE;
+	}
+
+	if (!reader.open(argv[optind]))
+	{
+		cerr << "Error reading trace file " << argv[optind] << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Just rebuild the schedule trace line
+	if (scheduleOnly)
+	{
+		cout << "TRACE ";
+		while (reader.next(record))
+		{
+			if (record.type == EVENT_SCHEDULE)
+			{
+				cout << record.taskID << ",";
+			}
+		}
+		cout << endl;
+		return EXIT_SUCCESS;
+	}
+
+	// Print the header
+	cout << "ALGORITHM " << reader.getAlgorithm() << endl;
+	cout << "RUNTIME " << reader.getRuntime() << endl;
+	cout << "CPS " << reader.getCyclesPerSec() << endl;
+	cout << "EVENTS " << reader.getEventCount() << endl;
+	cout << "DROPPED " << reader.getDroppedRecords() << endl;
+	for (unsigned int i = 0; i < reader.getTaskSet().size(); i++)
+	{
+		cout << "TASK " << i << " " << reader.getTaskSet()[i].computeTime << " " <<
+				reader.getTaskSet()[i].periodTime << endl;
+	}
+
+	// Print the events relative to the first one
+	usPerCycle = (reader.getCyclesPerSec() > 0) ? (1000000.0 / reader.getCyclesPerSec()) : 0.0;
+	while (reader.next(record))
+	{
+		if (!haveFirst)
+		{
+			first = record.timestamp;
+			haveFirst = true;
+		}
+		printf("%.3f %u %u\n", (double)(int64_t)(record.timestamp - first) * usPerCycle,
+				record.type, record.taskID);
+	}
+
+	return EXIT_SUCCESS;
+}